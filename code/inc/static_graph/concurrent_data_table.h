@@ -0,0 +1,232 @@
+/*	Copyright(C)
+    Author: 479764650@qq.com
+    Description: 单写多读的并发KV数据表,读者通过顺序锁无锁读取
+    History: 2026/10/17
+*/
+
+#ifndef CONCURRENT_DATA_TABLE_H
+#define CONCURRENT_DATA_TABLE_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <thread>
+#include "data_table.h"
+
+// 共享槽位的拷贝均为relaxed原子访问,读写并发时不构成数据竞争:
+// 对齐到8字节的部分按uint64_t逐字搬运,首尾不足一字的部分逐字节搬运;
+// Capacity为调用方缓冲区的编译期容量,不足一字时不生成按字搬运
+template <size_t Capacity = SIZE_MAX>
+void StoreShared(char* shared, const char* src, size_t size)
+{
+    size_t head = std::min(size, -reinterpret_cast<uintptr_t>(shared) % sizeof(uint64_t));
+    size_t i = 0;
+    for (; i < head; ++i)
+    {
+        std::atomic_ref<char>(shared[i]).store(src[i], std::memory_order_relaxed);
+    }
+    if constexpr (Capacity >= sizeof(uint64_t))
+    {
+        for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+        {
+            uint64_t word;
+            std::memcpy(&word, src + i, sizeof(word));
+            std::atomic_ref<uint64_t>(*reinterpret_cast<uint64_t*>(shared + i))
+                .store(word, std::memory_order_relaxed);
+        }
+    }
+    for (; i < size; ++i)
+    {
+        std::atomic_ref<char>(shared[i]).store(src[i], std::memory_order_relaxed);
+    }
+}
+
+// 只读的relaxed原子加载;C++20没有atomic_ref<const T>,GCC/Clang以内建函数直接读取const对象
+template <typename T>
+T LoadRelaxed(const T& shared)
+{
+#if __GNUC__
+    return __atomic_load_n(&shared, __ATOMIC_RELAXED);
+#else
+    return std::atomic_ref<T>(const_cast<T&>(shared)).load(std::memory_order_relaxed);
+#endif
+}
+
+template <size_t Capacity = SIZE_MAX>
+void LoadShared(char* dst, const char* shared, size_t size)
+{
+    size_t head = std::min(size, -reinterpret_cast<uintptr_t>(shared) % sizeof(uint64_t));
+    size_t i = 0;
+    for (; i < head; ++i)
+    {
+        dst[i] = LoadRelaxed(shared[i]);
+    }
+    if constexpr (Capacity >= sizeof(uint64_t))
+    {
+        for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+        {
+            uint64_t word = LoadRelaxed(*reinterpret_cast<const uint64_t*>(shared + i));
+            std::memcpy(dst + i, &word, sizeof(word));
+        }
+    }
+    for (; i < size; ++i)
+    {
+        dst[i] = LoadRelaxed(shared[i]);
+    }
+}
+
+// 存储布局与DataTable一致,每个记录附带一个序号:
+// 写者写前序号置为奇数,写后置为偶数;读者拷贝前后序号一致且为偶数时副本有效,否则重读
+// 序号不小于2即记录至少完成过一次写入,是否已设置也由序号判断,不另设共享的掩码
+// 仅允许一个写者线程,读者线程数不限且互不写共享状态
+// 每个序号独占一条缓存行,写者更新一个记录不会使其他记录的读者失效;
+// Policy同DataTable,取CacheLayout<cacheLineSize>时各区域的数据也不共享缓存行
+template <TL Es, typename Policy = PackedLayout>
+class ConcurrentDataTable
+{
+private:
+    using Layout = DataTableLayout<Es, Policy>;
+
+    template <auto Key>
+    using EntryOf = typename Layout::template EntryOf<Key>;
+    template <auto Key>
+    using ValueOf = typename Layout::template ValueOf<Key>;
+    template <auto Key>
+    using ParamOf = typename Layout::template ParamOf<Key>;
+    // Get<Key>的返回类型,数组记录按值拷贝为std::array
+    template <auto Key>
+    using ResultOf = std::conditional_t<EntryOf<Key>::isArray,
+                                        std::array<ValueOf<Key>, EntryOf<Key>::dim>,
+                                        ValueOf<Key>>;
+
+    constexpr static size_t entriesNum = Es::size;
+    constexpr static auto& slots_ = Layout::slots;
+    // 读者连续重读的次数上限,超过后每次重读前让出时间片
+    constexpr static size_t maxSpins = 64;
+
+    struct alignas(cacheLineSize) Seq
+    {
+        // 64位,按每次写入加2不会回绕到表示未设置的0
+        std::atomic<uint64_t> value{0};
+    };
+
+    typename Layout::RegionsType regions_{};
+    std::array<Seq, entriesNum> seqs_{};
+
+    template <size_t Capacity = SIZE_MAX>
+    void Write(size_t ordinal, const char* value, size_t len)
+    {
+        const RegionSlot& slot = slots_[ordinal];
+        std::atomic<uint64_t>& seq = seqs_[ordinal].value;
+        uint64_t before = seq.load(std::memory_order_relaxed);
+        seq.store(before + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        StoreShared<Capacity>(regions_.Data() + slot.offset, value, std::min(len, slot.size));
+        seq.store(before + 2, std::memory_order_release);
+    }
+
+    template <size_t Capacity = SIZE_MAX>
+    void Read(size_t ordinal, char* out, size_t len) const
+    {
+        const RegionSlot& slot = slots_[ordinal];
+        const std::atomic<uint64_t>& seq = seqs_[ordinal].value;
+        len = std::min(len, slot.size);
+        uint64_t before = 0;
+        uint64_t after = 0;
+        for (size_t retries = 0;; ++retries)
+        {
+            before = seq.load(std::memory_order_acquire);
+            // 撕裂的副本会因序号变化被丢弃
+            LoadShared<Capacity>(out, regions_.Data() + slot.offset, len);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = seq.load(std::memory_order_relaxed);
+            if (!(before & 1) && before == after)
+            {
+                return;
+            }
+            // 线程多于核心时写者可能在写到一半时被换出,连续失败后让出时间片使其写完
+            if (retries >= maxSpins)
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    bool Present(size_t ordinal) const
+    {
+        // 首次写入进行中(序号为1)仍视为未设置
+        return seqs_[ordinal].value.load(std::memory_order_acquire) >= 2;
+    }
+
+    bool ReadOrdinal(size_t ordinal, void* out, size_t len) const
+    {
+        if (ordinal >= entriesNum || !Present(ordinal))
+        {
+            return false;
+        }
+        Read(ordinal, reinterpret_cast<char*>(out), len);
+        return true;
+    }
+
+    bool WriteOrdinal(size_t ordinal, const void* value, size_t len)
+    {
+        if (ordinal >= entriesNum)
+        {
+            return false;
+        }
+        Write(ordinal, reinterpret_cast<const char*>(value), len);
+        return true;
+    }
+
+public:
+    ConcurrentDataTable() = default;
+    ConcurrentDataTable(const ConcurrentDataTable&) = delete;
+    ConcurrentDataTable& operator=(const ConcurrentDataTable&) = delete;
+
+    // 读者接口,可在任意线程并发调用
+    bool GetData(size_t key, void* out, size_t len = -1) const
+    {
+        return ReadOrdinal(Layout::OrdinalOf(key), out, len);
+    }
+    bool GetData(std::string_view name, void* out, size_t len = -1) const
+    {
+        return ReadOrdinal(Layout::OrdinalOf(name), out, len);
+    }
+
+    template <auto Key>
+    ResultOf<Key> Get() const
+    {
+        ResultOf<Key> result{};
+        Read<sizeof(result)>(Layout::template ordinalOf<Key>, reinterpret_cast<char*>(&result),
+                             sizeof(result));
+        return result;
+    }
+
+    template <auto Key>
+    bool Has() const
+    {
+        return Present(Layout::template ordinalOf<Key>);
+    }
+
+    // 写者接口,同一时刻只能由一个线程调用
+    bool SetData(size_t key, const void* value, size_t len = -1)
+    {
+        return WriteOrdinal(Layout::OrdinalOf(key), value, len);
+    }
+    bool SetData(std::string_view name, const void* value, size_t len = -1)
+    {
+        return WriteOrdinal(Layout::OrdinalOf(name), value, len);
+    }
+
+    template <auto Key>
+    void Set(const ParamOf<Key>& value)
+    {
+        Write<sizeof(value)>(Layout::template ordinalOf<Key>, reinterpret_cast<const char*>(&value),
+                             sizeof(value));
+    }
+};
+
+#endif // !CONCURRENT_DATA_TABLE_H
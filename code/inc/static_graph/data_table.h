@@ -8,9 +8,18 @@
 #define DATA_TABLE_H
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <bitset>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string_view>
 #include <type_traits>
 #include <tuple>
+#include "fixed_string.h"
+#include "perfect_hash.h"
 #include "type_list.h"
 
 // 记录
@@ -28,19 +37,149 @@ struct Entry<Key, ValueType[Dim]> : Entry<Key, ValueType, Dim>
 {
 };
 
+// 键:任意整型或枚举(含enum class),无需连续;或FixedString名字,如"latency_ms"_fs
+template <typename K>
+concept IntegralKey = std::is_integral_v<K> || std::is_enum_v<K>;
+
+template <typename K>
+concept NamedKey = IsFixedString<K>::value;
+
+template <typename K>
+concept TableKey = IntegralKey<K> || NamedKey<K>;
+
 template <typename E>
 concept KVEntry = requires {
     typename E::type;
     requires std::is_standard_layout_v<typename E::type>;
     requires std::is_trivial_v<typename E::type>;
-    {
-        E::key
-    } -> std::convertible_to<size_t>;
+    requires TableKey<std::remove_cv_t<decltype(E::key)>>;
     {
         E::dim
     } -> std::convertible_to<size_t>;
 };
 
+// 参与完美哈希的64位键值:整型键取其值,名字取其哈希
+template <typename K>
+constexpr uint64_t KeyHash(const K& key)
+{
+    if constexpr (NamedKey<K>)
+    {
+        return NameHash(key.View());
+    }
+    else
+    {
+        return static_cast<uint64_t>(key);
+    }
+}
+
+// 编译期键相等:名字按内容比较,整型与枚举按数值比较,两类之间不相等
+template <auto A, auto B>
+constexpr bool SameKey()
+{
+    using KA = std::remove_cv_t<decltype(A)>;
+    using KB = std::remove_cv_t<decltype(B)>;
+    if constexpr (NamedKey<KA> && NamedKey<KB>)
+    {
+        return A.View() == B.View();
+    }
+    else if constexpr (!NamedKey<KA> && !NamedKey<KB>)
+    {
+        return static_cast<uint64_t>(A) == static_cast<uint64_t>(B);
+    }
+    else
+    {
+        return false;
+    }
+}
+
+// 键 -> 稠密序号[0, N):Keyed为带key成员的类型列表,键无需连续
+// 序号只取决于键的集合,与声明顺序无关
+// 名字键按哈希参与完美哈希,运行期查找时再与槽位上的名字比较一次以确认
+template <TL Keyed>
+class KeyMapTrait
+{
+private:
+    template <typename... Ks>
+    struct Build
+    {
+        constexpr static PerfectHash<sizeof...(Ks)> value{
+            std::array<uint64_t, sizeof...(Ks)>{KeyHash(Ks::key)...}};
+        constexpr static bool anyNamed = (NamedKey<std::remove_cv_t<decltype(Ks::key)>> || ...);
+
+        // 序号 -> 名字,整型键为空且named为false
+        constexpr static std::array<std::string_view, sizeof...(Ks)> names = [] {
+            std::array<std::string_view, sizeof...(Ks)> result{};
+            auto fill = [&result]<typename K>(const K& key) {
+                if constexpr (NamedKey<K>)
+                {
+                    result[value.Find(KeyHash(key))] = key.View();
+                }
+            };
+            (fill(Ks::key), ...);
+            return result;
+        }();
+        constexpr static std::array<bool, sizeof...(Ks)> named = [] {
+            std::array<bool, sizeof...(Ks)> result{};
+            ((result[value.Find(KeyHash(Ks::key))] = NamedKey<std::remove_cv_t<decltype(Ks::key)>>), ...);
+            return result;
+        }();
+    };
+    using Built = typename Keyed::template exportTo<Build>;
+
+public:
+    constexpr static auto& keyMap = Built::value;
+    static_assert(keyMap.Verify(), "keys must be distinct");
+
+    // 不存在时返回Keyed::size
+    constexpr static size_t OrdinalOf(uint64_t key)
+    {
+        size_t ordinal = keyMap.Find(key);
+        if constexpr (Built::anyNamed)
+        {
+            // 整型查找不得命中名字键的哈希
+            return ordinal < Keyed::size && !Built::named[ordinal] ? ordinal : Keyed::size;
+        }
+        else
+        {
+            return ordinal;
+        }
+    }
+
+    constexpr static size_t OrdinalOf(std::string_view name)
+    {
+        if constexpr (Built::anyNamed)
+        {
+            size_t ordinal = keyMap.Probe(NameHash(name));
+            return ordinal < Keyed::size && Built::named[ordinal] && SameName(Built::names[ordinal], name)
+                       ? ordinal
+                       : Keyed::size;
+        }
+        else
+        {
+            return Keyed::size;
+        }
+    }
+
+    constexpr static uint64_t KeyAt(size_t ordinal) { return keyMap.KeyAt(ordinal); }
+    constexpr static std::string_view NameAt(size_t ordinal) { return Built::names[ordinal]; }
+
+    template <auto Key>
+    constexpr static size_t ordinalOf = [] {
+        constexpr size_t ordinal = [] {
+            if constexpr (NamedKey<std::remove_cv_t<decltype(Key)>>)
+            {
+                return OrdinalOf(Key.View());
+            }
+            else
+            {
+                return OrdinalOf(static_cast<uint64_t>(Key));
+            }
+        }();
+        static_assert(ordinal < Keyed::size, "key is not in table");
+        return ordinal;
+    }();
+};
+
 // 记录分组器
 template <TL Entries = TypeList<>, TL GroupedEntries = TypeList<>>
 struct GroupEntriesTrait : GroupedEntries
@@ -72,15 +211,34 @@ using GroupEntriesTrait_t = GroupEntriesTrait<Entries, GroupedEntries>::type;
 template <KVEntry HeadEntry, KVEntry... TailEntries>
 class GenericRegion
 {
-private:
+public:
     constexpr static size_t entriesNum = sizeof...(TailEntries) + 1;
     constexpr static size_t maxSize =
         std::max(sizeof(typename HeadEntry::type),
                  alignof(typename HeadEntry::type)) *
         HeadEntry::dim;
-    char _data[entriesNum][maxSize];
+
+private:
+    // 按元素类型对齐,使编译期访问可以直接按类型读写;元素对象在unsigned char数组上隐式创建
+    alignas(typename HeadEntry::type) unsigned char _data[entriesNum][maxSize];
 
 public:
+    // 编译期已知槽位时的类型化访问,同组记录的大小与对齐一致
+    template <size_t NthEntry, typename T>
+    T* Slot()
+    {
+        static_assert(NthEntry < entriesNum, "entry is out of region");
+        static_assert(sizeof(T) * HeadEntry::dim <= maxSize &&
+                      alignof(T) == alignof(typename HeadEntry::type));
+        return reinterpret_cast<T*>(_data[NthEntry]);
+    }
+
+    template <size_t NthEntry, typename T>
+    const T* Slot() const
+    {
+        return const_cast<GenericRegion*>(this)->Slot<NthEntry, T>();
+    }
+
     bool GetData(size_t nthEntry, void* out, size_t len)
     {
         if (nthEntry >= entriesNum) [[unlikely]]
@@ -89,7 +247,7 @@ public:
         }
 
         std::copy_n(_data[nthEntry], std::min(len, maxSize),
-                    reinterpret_cast<char*>(out));
+                    reinterpret_cast<unsigned char*>(out));
         return true;
     }
 
@@ -100,7 +258,7 @@ public:
             return false;
         }
 
-        std::copy_n(reinterpret_cast<char*>(value), std::min(len, maxSize),
+        std::copy_n(reinterpret_cast<const unsigned char*>(value), std::min(len, maxSize),
                     _data[nthEntry]);
         return true;
     }
@@ -129,10 +287,123 @@ public:
 };
 */
 
-template <typename... R>
+// 运行期键派发策略
+// 按分组短路折叠查找,耗时随分组数线性增长
+struct FoldDispatch
+{
+};
+// 编译期生成键->(偏移,字节数)跳转表,一次查表加一次拷贝
+struct JumpTableDispatch
+{
+};
+
+// 存储布局策略
+constexpr size_t cacheLineSize = 64;
+
+// HotKeys为热记录:单独成组并排在存储最前,其后的冷记录从新的缓存行开始
+// RegionAlign非0时每个区域至少按该值对齐,取cacheLineSize可避免不同区域的写者伪共享
+template <size_t RegionAlign = 0, auto... HotKeys>
+struct CacheLayout
+{
+    static_assert(RegionAlign == 0 || std::has_single_bit(RegionAlign), "region alignment must be a power of 2");
+    constexpr static size_t regionAlign = RegionAlign;
+    constexpr static size_t hotKeysNum = sizeof...(HotKeys);
+    constexpr static bool compact = false;
+
+    template <auto Key>
+    constexpr static bool isHot = (SameKey<Key, HotKeys>() || ...);
+};
+
+// 默认布局:不区分冷热,区域按分组顺序排列,各自按对齐补齐
+using PackedLayout = CacheLayout<>;
+
+// 紧凑布局:区域按对齐从大到小排列,区域之间无填充;
+// 键->区域索引所有实例相同,以最窄整型静态存放,每个实例只保留掩码
+struct CompactLayout
+{
+    constexpr static size_t regionAlign = 0;
+    constexpr static size_t hotKeysNum = 0;
+    constexpr static bool compact = true;
+
+    template <auto Key>
+    constexpr static bool isHot = false;
+};
+
+// 跳转表项:槽位相对Regions存储起点的偏移及字节数
+struct RegionSlot
+{
+    size_t offset;
+    size_t size;
+};
+
+// 所有区域连续存放在一块对齐的存储中,各区域偏移在编译期确定
+// 每个区域至少按RegionAlign对齐;前HotRegions个为热区域,其后的第一个区域从新的缓存行开始
+template <size_t RegionAlign, size_t HotRegions, typename... R>
 class Regions
 {
+private:
+    template <size_t RegionIdx>
+    using RegionAt = std::tuple_element_t<RegionIdx, std::tuple<R...>>;
+
 public:
+    constexpr static size_t regionsNum = sizeof...(R);
+    constexpr static size_t hotRegions = HotRegions;
+    constexpr static size_t alignment =
+        std::max({RegionAlign, HotRegions > 0 ? cacheLineSize : size_t{1}, alignof(R)...});
+
+    // 各区域的起始对齐
+    constexpr static std::array<size_t, regionsNum> aligns = [] {
+        std::array<size_t, regionsNum> result{};
+        constexpr size_t natural[]{size_t{1}, alignof(R)...};
+        for (size_t i = 0; i < regionsNum; ++i)
+        {
+            result[i] = std::max(natural[i + 1], RegionAlign);
+            if (i == HotRegions && HotRegions > 0)
+            {
+                result[i] = std::max(result[i], cacheLineSize);
+            }
+        }
+        return result;
+    }();
+
+private:
+    constexpr static std::array<size_t, regionsNum + 1> offsets = [] {
+        std::array<size_t, regionsNum + 1> result{};
+        constexpr size_t sizes[]{size_t{0}, sizeof(R)...};
+        for (size_t i = 0; i < regionsNum; ++i)
+        {
+            size_t end = result[i] + sizes[i + 1];
+            size_t align = i + 1 < regionsNum ? aligns[i + 1] : alignment;
+            result[i + 1] = (end + align - 1) / align * align;
+        }
+        return result;
+    }();
+
+public:
+    // 连续存储的总字节数
+    constexpr static size_t bytes = std::max(offsets[regionsNum], size_t{1});
+
+    // 区域的起始偏移与字节数,不含其后的填充
+    constexpr static size_t RegionOffset(size_t regionIdx) { return offsets[regionIdx]; }
+    constexpr static size_t RegionBytes(size_t regionIdx)
+    {
+        constexpr size_t sizes[]{size_t{0}, sizeof(R)...};
+        return sizes[regionIdx + 1];
+    }
+
+    // 区域idx高16位为区域序号,低16位为区域内序号
+    constexpr static RegionSlot SlotOf(size_t index)
+    {
+        constexpr size_t slotSizes[]{size_t{0}, R::maxSize...};
+        size_t regionIdx = index >> 16;
+        size_t nthEntry = index & 0xFFFF;
+        return {offsets[regionIdx] + nthEntry * slotSizes[regionIdx + 1],
+                slotSizes[regionIdx + 1]};
+    }
+
+    char* Data() { return reinterpret_cast<char*>(storage_); }
+    const char* Data() const { return reinterpret_cast<const char*>(storage_); }
+
     bool GetData(size_t index, void* out, size_t len)
     {
         auto op = [&](auto& region, size_t nthEntry) {
@@ -149,15 +420,27 @@ public:
         return ProcData(std::make_index_sequence<sizeof...(R)>{}, op, index);
     }
 
+    template <size_t RegionIdx>
+    auto& GetRegion()
+    {
+        return *reinterpret_cast<RegionAt<RegionIdx>*>(storage_ + offsets[RegionIdx]);
+    }
+
+    template <size_t RegionIdx>
+    const auto& GetRegion() const
+    {
+        return *reinterpret_cast<const RegionAt<RegionIdx>*>(storage_ + offsets[RegionIdx]);
+    }
+
 private:
     template <size_t _Index, typename _Op>
-    bool ProcData(size_t index, _Op&& op)
+    bool ProcData(_Op&& op, size_t index)
     {
         size_t regionIdx = index >> 16;
         size_t nthEntry = index & 0xFFFF;
         if (_Index == regionIdx)
         {
-            return op(std::get<_Index>(regions_), nthEntry);
+            return op(GetRegion<_Index>(), nthEntry);
         }
         return false;
     }
@@ -170,7 +453,8 @@ private:
     }
 
 private:
-    std::tuple<R...> regions_;
+    // 各GenericRegion均为平凡类型,在unsigned char数组上隐式创建
+    alignas(alignment) unsigned char storage_[bytes];
 };
 
 template <TL GroupedEntries>
@@ -187,24 +471,43 @@ public:
 template <TL GroupedEntries>
 using GenericRegionTrait_t = typename GenericRegionTrait<GroupedEntries>::type;
 
-template <TL GroupedEntries>
-using RegionsInst =
-    typename GenericRegionTrait_t<GroupedEntries>::template exportTo<Regions>;
+template <TL GroupedEntries, size_t RegionAlign = 0, size_t HotRegions = 0>
+class RegionsTrait
+{
+private:
+    template <typename... R>
+    using Bind = Regions<RegionAlign, HotRegions, R...>;
+
+public:
+    using type = typename GenericRegionTrait_t<GroupedEntries>::template exportTo<Bind>;
+};
+
+template <TL GroupedEntries, size_t RegionAlign = 0, size_t HotRegions = 0>
+using RegionsInst = typename RegionsTrait<GroupedEntries, RegionAlign, HotRegions>::type;
 
+// 以键的稠密序号为下标
 template <typename... Indexes>
 struct Indexer
 {
+    using KeyMap = KeyMapTrait<TypeList<Indexes...>>;
     size_t keyToId[sizeof...(Indexes)];
     std::bitset<sizeof...(Indexes)> mask;
     constexpr Indexer()
     {
-        constexpr size_t indexSize = sizeof...(Indexes);
-        static_assert(((Indexes::key < indexSize) && ...),
-                      "key is out of size");
-        (void(keyToId[Indexes::key] == Indexes::id), ...);
+        ((keyToId[KeyMap::template ordinalOf<Indexes::key>] = Indexes::id), ...);
     }
 };
 
+// 索引项:id高16位为区域序号,低16位为区域内序号
+// 定义在外层,避免类型名携带Fold的累积结果导致编译开销随记录数立方增长
+template <KVEntry E, size_t Id>
+struct KeyWithIndex
+{
+    using entry = E;
+    constexpr static auto key = E::key;
+    constexpr static size_t id = Id;
+};
+
 template <TL GroupedEntries>
 class GroupIndexTrait
 {
@@ -226,12 +529,7 @@ private:
         class AddKey
         {
             constexpr static size_t innerIdx = Acc_::innerIdx;
-            struct KeyWithIndex
-            {
-                constexpr static auto key = E::key;
-                constexpr static auto id = groupIdx << 16 | innerIdx;
-            };
-            using result = typename Acc_::result::template append<KeyWithIndex>;
+            using result = typename Acc_::result::template append<KeyWithIndex<E, groupIdx << 16 | innerIdx>>;
 
         public:
             using type = Index<groupIdx + 1, innerIdx + 1, result>;
@@ -246,35 +544,889 @@ public:
     using type = typename Fold_t<GroupedEntries, Index<>, AddGroup>::result;
 };
 
-template <TL GroupedEntries>
-using IndexerInst =
-    typename GroupIndexTrait<GroupedEntries>::type::template exportTo<Indexer>;
+// 紧凑模式的索引:键->区域索引为编译期常量,用能容纳最大索引的最窄整型
+template <typename... Indexes>
+struct CompactIndexer
+{
+    using KeyMap = KeyMapTrait<TypeList<Indexes...>>;
+    using Id = SmallestUint_t<std::max({size_t{0}, Indexes::id...})>;
+    constexpr static std::array<Id, sizeof...(Indexes)> keyToId = [] {
+        std::array<Id, sizeof...(Indexes)> result{};
+        ((result[KeyMap::template ordinalOf<Indexes::key>] = Indexes::id), ...);
+        return result;
+    }();
+    std::bitset<sizeof...(Indexes)> mask;
+};
 
-template <TL Es>
-class DataTable
+template <TL GroupedEntries, bool Compact = false>
+class IndexerTrait
 {
 private:
-    RegionsInst<Es> regions_;
-    IndexerInst<Es> indexer_;
+    using Indexes = typename GroupIndexTrait<GroupedEntries>::type;
 
 public:
-    bool GetData(size_t key, void* out, size_t len = -1)
+    using type = std::conditional_t<Compact, typename Indexes::template exportTo<CompactIndexer>,
+                                    typename Indexes::template exportTo<Indexer>>;
+};
+
+template <TL GroupedEntries, bool Compact = false>
+using IndexerInst = typename IndexerTrait<GroupedEntries, Compact>::type;
+
+// 编译期按键查找索引项
+template <TL Indexes, auto Key>
+class KeyIndexTrait
+{
+    template <typename Index>
+    using IsKey = std::bool_constant<SameKey<Index::key, Key>()>;
+    using Found = Filter_t<Indexes, IsKey>;
+    static_assert(Found::size == 1, "key is not in table");
+
+public:
+    using type = Head_t<Found>;
+};
+
+template <TL Indexes, auto Key>
+using KeyIndexTrait_t = typename KeyIndexTrait<Indexes, Key>::type;
+
+// 运行期长度的拷贝:常量长度内联后由编译器特化为定长搬运
+inline void CopySlot(char* dst, const char* src, size_t size)
+{
+    std::memcpy(dst, src, size);
+}
+
+// 批量读写中的一次搬运:槽位偏移,打包缓冲区偏移,字节数
+struct BatchMove
+{
+    size_t slot;
+    size_t packed;
+    size_t size;
+};
+
+// 批量读写计划:打包缓冲区按键列表顺序紧密排列各记录,
+// 搬运按存储顺序排列,槽位与缓冲区均相邻的搬运合并为一次
+template <size_t N>
+struct BatchPlan
+{
+    std::array<BatchMove, N> moves{};
+    size_t count = 0;
+    size_t bytes = 0;
+
+    constexpr BatchPlan() = default;
+    constexpr BatchPlan(const RegionSlot* slots, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            // 插入排序,保持同槽位的先后顺序
+            BatchMove move{slots[i].offset, bytes, slots[i].size};
+            size_t pos = i;
+            for (; pos > 0 && moves[pos - 1].slot > move.slot; --pos)
+            {
+                moves[pos] = moves[pos - 1];
+            }
+            moves[pos] = move;
+            bytes += slots[i].size;
+        }
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (count > 0)
+            {
+                BatchMove& last = moves[count - 1];
+                if (last.slot + last.size == moves[i].slot &&
+                    last.packed + last.size == moves[i].packed)
+                {
+                    last.size += moves[i].size;
+                    continue;
+                }
+            }
+            moves[count++] = moves[i];
+        }
+    }
+};
+
+// 序列化数据表的头部
+struct TableHeader
+{
+    constexpr static uint32_t magicValue = 0x54445243; // "CRDT"
+    constexpr static uint32_t versionValue = 1;
+
+    uint32_t magic;
+    uint32_t version;
+    uint64_t schemaHash;
+    uint64_t regionBytes;
+    uint64_t maskWords;
+};
+
+// 增量数据:DeltaHeader后接count条DeltaRecord,每条之后紧跟size字节的记录内容
+struct DeltaHeader
+{
+    uint64_t schemaHash;
+    uint32_t count;
+    uint32_t bytes; // 含头部的总字节数
+};
+
+struct DeltaRecord
+{
+    uint32_t ordinal; // 键的稠密序号,schemaHash一致时两端相同
+    uint32_t size;
+};
+
+// 布局报告中的一条记录
+struct EntryLayout
+{
+    uint64_t key;          // 整型键的值,名字键为名字哈希
+    std::string_view name; // 名字键的名字,整型键为空
+    size_t region;
+    size_t offset; // 相对区域存储起点
+    size_t bytes;
+    bool hot;
+};
+
+struct RegionLayout
+{
+    size_t offset;
+    size_t bytes;
+    size_t align;
+    size_t padding; // 到下一区域或存储末尾的填充字节
+    bool hot;
+};
+
+// 编译期布局报告:各记录与区域的偏移、填充及总占用
+template <size_t EntriesNum, size_t RegionsNum>
+struct LayoutReport
+{
+    std::array<EntryLayout, EntriesNum> entries{}; // 按键的稠密序号排列
+    std::array<RegionLayout, RegionsNum> regions{};
+    size_t payloadBytes = 0; // 各记录sizeof(T) * dim之和
+    size_t paddingBytes = 0; // totalBytes - payloadBytes
+    size_t hotBytes = 0;     // 热区域的末尾偏移
+    size_t totalBytes = 0;   // 区域存储的字节数
+    size_t alignment = 0;
+
+    // 记录跨越的缓存行数,以存储起点为缓存行起点计
+    constexpr size_t LinesOf(size_t ordinal) const
+    {
+        const EntryLayout& entry = entries[ordinal];
+        return (entry.offset + entry.bytes - 1) / cacheLineSize - entry.offset / cacheLineSize + 1;
+    }
+
+    // 容纳全部热记录的缓存行数
+    constexpr size_t HotLines() const { return (hotBytes + cacheLineSize - 1) / cacheLineSize; }
+};
+
+// 单个DataTable实例的内存占用
+struct TableFootprint
+{
+    size_t bytes;         // sizeof(DataTable)
+    size_t payloadBytes;  // 各记录sizeof(T) * dim之和
+    size_t regionBytes;   // 区域存储,含区域间及末尾填充
+    size_t indexBytes;    // 键->区域索引及记录掩码
+    size_t dirtyBytes;    // 脏记录位图
+    size_t overheadBytes; // bytes - payloadBytes
+};
+
+// DataTable的存储布局:分组、索引、区域以及键->槽位跳转表,供各类数据表复用
+// Policy为布局策略,见CacheLayout
+template <TL Es, typename Policy = PackedLayout>
+struct DataTableLayout
+{
+private:
+    template <typename E>
+    using IsHot = std::bool_constant<Policy::template isHot<E::key>>;
+    using HotEntries = Partition_t<Es, IsHot>;
+    static_assert(HotEntries::Satisfied::size == Policy::hotKeysNum, "hot key is not in table or repeated");
+
+    // 紧凑模式按对齐从大到小排列分组,每个区域的字节数都是其对齐的整数倍,相邻区域间因此无填充
+    template <TL L, TL R>
+    using AlignGreater = std::bool_constant<(alignof(typename Head_t<L>::type) > alignof(typename Head_t<R>::type))>;
+    template <TL Groups>
+    using Arrange = std::conditional_t<Policy::compact, Sort_t<Groups, AlignGreater>, Groups>;
+
+    // 热记录与冷记录分别分组,热分组在前
+    using HotGroups = Arrange<GroupEntriesTrait_t<typename HotEntries::Satisfied>>;
+    using ColdGroups = Arrange<GroupEntriesTrait_t<typename HotEntries::Rest>>;
+
+public:
+    using KeyMap = KeyMapTrait<Es>;
+    using GroupedEntries = Concat_t<HotGroups, ColdGroups>;
+    using Indexes = typename GroupIndexTrait<GroupedEntries>::type;
+    using RegionsType = RegionsInst<GroupedEntries, Policy::regionAlign, HotGroups::size>;
+
+    template <auto Key>
+    using IndexOf = KeyIndexTrait_t<Indexes, Key>;
+    template <auto Key>
+    using EntryOf = typename IndexOf<Key>::entry;
+    template <auto Key>
+    using ValueOf = typename EntryOf<Key>::type;
+    // Set<Key>的入参类型,数组记录按整个数组传入
+    template <auto Key>
+    using ParamOf = std::conditional_t<EntryOf<Key>::isArray,
+                                       ValueOf<Key>[EntryOf<Key>::dim],
+                                       ValueOf<Key>>;
+
+    template <auto Key>
+    constexpr static RegionSlot slotOf = RegionsType::SlotOf(IndexOf<Key>::id);
+
+    template <auto Key>
+    constexpr static size_t ordinalOf = KeyMap::template ordinalOf<Key>;
+
+    constexpr static size_t OrdinalOf(uint64_t key) { return KeyMap::OrdinalOf(key); }
+    constexpr static size_t OrdinalOf(std::string_view name) { return KeyMap::OrdinalOf(name); }
+
+private:
+    template <typename... Indexes_>
+    struct SlotTable
+    {
+        constexpr static std::array<RegionSlot, sizeof...(Indexes_)> value = [] {
+            std::array<RegionSlot, sizeof...(Indexes_)> result{};
+            ((result[KeyMap::template ordinalOf<Indexes_::key>] = RegionsType::SlotOf(Indexes_::id)), ...);
+            return result;
+        }();
+    };
+
+    // 序号 -> 单个元素的字节数
+    template <typename... Indexes_>
+    struct ElemSizeTable
+    {
+        constexpr static std::array<size_t, sizeof...(Indexes_)> value = [] {
+            std::array<size_t, sizeof...(Indexes_)> result{};
+            ((result[KeyMap::template ordinalOf<Indexes_::key>] = sizeof(typename Indexes_::entry::type)), ...);
+            return result;
+        }();
+    };
+
+    // 布局指纹:记录的键、尺寸、对齐、维度及数值类别,用于校验序列化数据
+    template <typename T>
+    constexpr static uint64_t typeTag = uint64_t{std::is_floating_point_v<T>} << 2 |
+                                        uint64_t{std::is_signed_v<T>} << 1 |
+                                        uint64_t{std::is_integral_v<T>};
+
+    template <typename... Entries>
+    struct SchemaHash
+    {
+        constexpr static uint64_t value = [] {
+            uint64_t hash = 14695981039346656037ull; // FNV-1a
+            auto mix = [&hash](uint64_t v) {
+                for (size_t i = 0; i < sizeof(v); ++i)
+                {
+                    hash = (hash ^ (v >> (i * 8) & 0xFF)) * 1099511628211ull;
+                }
+            };
+            ((mix(KeyHash(Entries::key)), mix(sizeof(typename Entries::type)),
+              mix(alignof(typename Entries::type)), mix(Entries::dim), mix(typeTag<typename Entries::type>),
+              mix(slotOf<Entries::key>.offset)),
+             ...);
+            mix(RegionsType::bytes);
+            return hash;
+        }();
+    };
+
+    constexpr static size_t AlignUp(size_t n, size_t align) { return (n + align - 1) / align * align; }
+
+    template <typename... Indexes_>
+    struct Report
+    {
+        constexpr static LayoutReport<sizeof...(Indexes_), RegionsType::regionsNum> value = [] {
+            LayoutReport<sizeof...(Indexes_), RegionsType::regionsNum> report{};
+            auto nameOf = []<typename K>(const K& key) {
+                if constexpr (NamedKey<K>)
+                {
+                    return key.View();
+                }
+                else
+                {
+                    return std::string_view{};
+                }
+            };
+            ((report.entries[KeyMap::template ordinalOf<Indexes_::key>] =
+                  EntryLayout{KeyHash(Indexes_::key), nameOf(Indexes_::key), Indexes_::id >> 16,
+                              RegionsType::SlotOf(Indexes_::id).offset,
+                              sizeof(typename Indexes_::entry::type) * Indexes_::entry::dim,
+                              Policy::template isHot<Indexes_::key>}),
+             ...);
+            for (const EntryLayout& entry : report.entries)
+            {
+                report.payloadBytes += entry.bytes;
+            }
+            for (size_t i = 0; i < RegionsType::regionsNum; ++i)
+            {
+                size_t offset = RegionsType::RegionOffset(i);
+                size_t bytes = RegionsType::RegionBytes(i);
+                size_t next = i + 1 < RegionsType::regionsNum ? RegionsType::RegionOffset(i + 1) : RegionsType::bytes;
+                bool hot = i < RegionsType::hotRegions;
+                report.regions[i] = RegionLayout{offset, bytes, RegionsType::aligns[i], next - offset - bytes, hot};
+                if (hot)
+                {
+                    report.hotBytes = offset + bytes;
+                }
+            }
+            report.totalBytes = RegionsType::bytes;
+            report.paddingBytes = report.totalBytes - report.payloadBytes;
+            report.alignment = RegionsType::alignment;
+            return report;
+        }();
+    };
+
+public:
+    // 序号 -> 槽位跳转表
+    constexpr static auto& slots = Indexes::template exportTo<SlotTable>::value;
+    constexpr static auto& elemSizes = Indexes::template exportTo<ElemSizeTable>::value;
+
+    // 序号有效且T与记录的元素大小一致
+    template <typename T>
+    constexpr static bool ElemIs(size_t ordinal)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return ordinal < Es::size && elemSizes[ordinal] == sizeof(T);
+    }
+
+    // 记录中第[first, first + count)个元素所在的槽位片段,序号或区间越界时返回std::nullopt
+    constexpr static std::optional<RegionSlot> ElementsOf(size_t ordinal, size_t first, size_t count)
+    {
+        if (ordinal >= Es::size)
+        {
+            return std::nullopt;
+        }
+        const size_t dim = slots[ordinal].size / elemSizes[ordinal];
+        if (first > dim || count > dim - first)
+        {
+            return std::nullopt;
+        }
+        return RegionSlot{slots[ordinal].offset + first * elemSizes[ordinal], count * elemSizes[ordinal]};
+    }
+
+    constexpr static uint64_t schemaHash = Es::template exportTo<SchemaHash>::value;
+
+    constexpr static auto& report = Indexes::template exportTo<Report>::value;
+    static_assert(!Policy::compact || report.paddingBytes < RegionsType::alignment,
+                  "compact layout must only pad the tail of the region storage");
+
+    // 序列化格式:TableHeader | 区域存储块 | 记录掩码(64位字,本机字节序)
+    // 总长按对齐补齐,多个表可首尾相接存放
+    constexpr static size_t maskWords = (Es::size + 63) / 64;
+    constexpr static size_t serialAlign = std::max(RegionsType::alignment, alignof(uint64_t));
+    constexpr static size_t regionOffset = AlignUp(sizeof(TableHeader), serialAlign);
+    constexpr static size_t maskOffset = AlignUp(regionOffset + RegionsType::bytes, alignof(uint64_t));
+    constexpr static size_t serializedBytes = AlignUp(maskOffset + maskWords * sizeof(uint64_t), serialAlign);
+
+    constexpr static TableHeader header{TableHeader::magicValue, TableHeader::versionValue, schemaHash,
+                                        RegionsType::bytes, maskWords};
+};
+
+template <TL Es, typename Dispatch = JumpTableDispatch, typename Policy = PackedLayout>
+class DataTable
+{
+private:
+    using Layout = DataTableLayout<Es, Policy>;
+    using GroupedEntries = typename Layout::GroupedEntries;
+    using RegionsType = typename Layout::RegionsType;
+
+    template <auto Key>
+    using IndexOf = typename Layout::template IndexOf<Key>;
+    template <auto Key>
+    using EntryOf = typename Layout::template EntryOf<Key>;
+    template <auto Key>
+    using ValueOf = typename Layout::template ValueOf<Key>;
+    template <auto Key>
+    using ParamOf = typename Layout::template ParamOf<Key>;
+
+    constexpr static auto& slots_ = Layout::slots;
+
+    RegionsType regions_;
+    IndexerInst<GroupedEntries, Policy::compact> indexer_;
+    // 脏记录位图,按64位字存放便于位扫描
+    std::array<uint64_t, Layout::maskWords> dirty_{};
+
+    void MarkDirty(size_t ordinal) { dirty_[ordinal / 64] |= uint64_t{1} << (ordinal % 64); }
+
+    // 按位扫描依次访问脏记录
+    template <typename Op>
+    void ForEachDirty(Op&& op) const
+    {
+        for (size_t i = 0; i < dirty_.size(); ++i)
+        {
+            for (uint64_t word = dirty_[i]; word != 0; word &= word - 1)
+            {
+                op(i * 64 + std::countr_zero(word));
+            }
+        }
+    }
+
+    template <auto... Keys>
+    constexpr static BatchPlan<sizeof...(Keys)> batchPlan_ = [] {
+        constexpr RegionSlot slots[]{Layout::template slotOf<Keys>...};
+        return BatchPlan<sizeof...(Keys)>(slots, sizeof...(Keys));
+    }();
+
+    template <auto Key>
+    ValueOf<Key>* Slot()
+    {
+        constexpr size_t id = IndexOf<Key>::id;
+        return regions_.template GetRegion<(id >> 16)>()
+            .template Slot<(id & 0xFFFF), ValueOf<Key>>();
+    }
+
+    template <auto Key>
+    const ValueOf<Key>* Slot() const
+    {
+        constexpr size_t id = IndexOf<Key>::id;
+        return regions_.template GetRegion<(id >> 16)>()
+            .template Slot<(id & 0xFFFF), ValueOf<Key>>();
+    }
+
+    // 只写入存储,不改变脏标记;同步应用外部增量时使用
+    bool StoreOrdinal(size_t ordinal, const void* value, size_t len)
+    {
+        if constexpr (std::is_same_v<Dispatch, JumpTableDispatch>)
+        {
+            const RegionSlot& slot = slots_[ordinal];
+            CopySlot(regions_.Data() + slot.offset, reinterpret_cast<const char*>(value),
+                     std::min(len, slot.size));
+            indexer_.mask[ordinal] = true;
+        }
+        else
+        {
+            indexer_.mask[ordinal] =
+                regions_.SetData(indexer_.keyToId[ordinal], value, len);
+        }
+        return indexer_.mask[ordinal];
+    }
+
+    bool SetOrdinal(size_t ordinal, const void* value, size_t len)
+    {
+        bool stored = StoreOrdinal(ordinal, value, len);
+        MarkDirty(ordinal);
+        return stored;
+    }
+
+    bool GetOrdinal(size_t ordinal, void* out, size_t len)
+    {
+        if (ordinal >= Es::size || !indexer_.mask[ordinal])
+        {
+            return false;
+        }
+        if constexpr (std::is_same_v<Dispatch, JumpTableDispatch>)
+        {
+            const RegionSlot& slot = slots_[ordinal];
+            CopySlot(reinterpret_cast<char*>(out), regions_.Data() + slot.offset,
+                     std::min(len, slot.size));
+            return true;
+        }
+        else
+        {
+            return regions_.GetData(indexer_.keyToId[ordinal], out, len);
+        }
+    }
+
+    bool GetRangeOrdinal(size_t ordinal, size_t first, size_t count, void* out) const
     {
-        if (key >= Es::size || !indexer_.mask[key])
+        auto range = Layout::ElementsOf(ordinal, first, count);
+        if (!range || !indexer_.mask[ordinal])
         {
             return false;
         }
-        return regions_.GetData(indexer_.keyToId[key], out, len);
+        CopySlot(reinterpret_cast<char*>(out), regions_.Data() + range->offset, range->size);
+        return true;
+    }
+
+    bool SetRangeOrdinal(size_t ordinal, size_t first, size_t count, const void* in)
+    {
+        auto range = Layout::ElementsOf(ordinal, first, count);
+        if (!range)
+        {
+            return false;
+        }
+        // 存储不做初始化,首次部分写入时先把整个记录清零,未写到的元素读出为0
+        if (!indexer_.mask[ordinal])
+        {
+            std::memset(regions_.Data() + slots_[ordinal].offset, 0, slots_[ordinal].size);
+        }
+        CopySlot(regions_.Data() + range->offset, reinterpret_cast<const char*>(in), range->size);
+        indexer_.mask[ordinal] = true;
+        MarkDirty(ordinal);
+        return true;
     }
+
+public:
+    // 编译期布局报告:各记录偏移、区域填充及总占用
+    constexpr static auto& layout = Layout::report;
+
+    // 单个实例的内存占用;紧凑模式下校验成员之间没有填充
+    constexpr static TableFootprint Footprint()
+    {
+        constexpr size_t members = sizeof(regions_) + sizeof(indexer_) + sizeof(dirty_);
+        static_assert(!Policy::compact || sizeof(DataTable) == members, "compact table has padding between members");
+        return TableFootprint{sizeof(DataTable), Layout::report.payloadBytes, sizeof(regions_), sizeof(indexer_),
+                              sizeof(dirty_), sizeof(DataTable) - Layout::report.payloadBytes};
+    }
+
+    bool GetData(size_t key, void* out, size_t len = -1) { return GetOrdinal(Layout::OrdinalOf(key), out, len); }
     bool SetData(size_t key, const void* value, size_t len = -1)
     {
-        if (key >= Es::size)
+        size_t ordinal = Layout::OrdinalOf(key);
+        return ordinal < Es::size && SetOrdinal(ordinal, value, len);
+    }
+
+    // 运行期名字访问:完美哈希定位槽位后比较一次名字确认
+    bool GetData(std::string_view name, void* out, size_t len = -1)
+    {
+        return GetOrdinal(Layout::OrdinalOf(name), out, len);
+    }
+    bool SetData(std::string_view name, const void* value, size_t len = -1)
+    {
+        size_t ordinal = Layout::OrdinalOf(name);
+        return ordinal < Es::size && SetOrdinal(ordinal, value, len);
+    }
+
+    // 数组记录的部分读写:只拷贝第[first, first + count)个元素,不触及记录的其余部分
+    // 键不存在或区间越界时返回false,读取未设置的记录返回false,写入后记录视为已设置,其余元素为0
+    bool GetRange(size_t key, size_t first, size_t count, void* out) const
+    {
+        return GetRangeOrdinal(Layout::OrdinalOf(key), first, count, out);
+    }
+    bool SetRange(size_t key, size_t first, size_t count, const void* in)
+    {
+        return SetRangeOrdinal(Layout::OrdinalOf(key), first, count, in);
+    }
+    bool GetRange(std::string_view name, size_t first, size_t count, void* out) const
+    {
+        return GetRangeOrdinal(Layout::OrdinalOf(name), first, count, out);
+    }
+    bool SetRange(std::string_view name, size_t first, size_t count, const void* in)
+    {
+        return SetRangeOrdinal(Layout::OrdinalOf(name), first, count, in);
+    }
+
+    // 数组记录的单个元素,T的大小须与元素类型一致;标量记录以i = 0访问
+    template <typename T>
+    bool Get(size_t key, size_t i, T& out) const
+    {
+        size_t ordinal = Layout::OrdinalOf(key);
+        return Layout::template ElemIs<T>(ordinal) && GetRangeOrdinal(ordinal, i, 1, &out);
+    }
+    template <typename T>
+    bool Set(size_t key, size_t i, const T& value)
+    {
+        size_t ordinal = Layout::OrdinalOf(key);
+        return Layout::template ElemIs<T>(ordinal) && SetRangeOrdinal(ordinal, i, 1, &value);
+    }
+    template <typename T>
+    bool Get(std::string_view name, size_t i, T& out) const
+    {
+        size_t ordinal = Layout::OrdinalOf(name);
+        return Layout::template ElemIs<T>(ordinal) && GetRangeOrdinal(ordinal, i, 1, &out);
+    }
+    template <typename T>
+    bool Set(std::string_view name, size_t i, const T& value)
+    {
+        size_t ordinal = Layout::OrdinalOf(name);
+        return Layout::template ElemIs<T>(ordinal) && SetRangeOrdinal(ordinal, i, 1, &value);
+    }
+
+    // 编译期键访问:直接定位到GenericRegion槽位,无运行期派发
+    // 标量返回值本身,数组返回指向存储的std::span,按下标或subspan读取不拷贝整个数组;
+    // 不检查掩码,需要时先调用Has<Key>
+    template <auto Key>
+    auto Get() const
+    {
+        if constexpr (EntryOf<Key>::isArray)
+        {
+            return std::span<const ValueOf<Key>, EntryOf<Key>::dim>(
+                Slot<Key>(), EntryOf<Key>::dim);
+        }
+        else
+        {
+            return *Slot<Key>();
+        }
+    }
+
+    // 可写引用,经由引用的修改不会更新掩码
+    template <auto Key>
+    decltype(auto) Ref()
+    {
+        if constexpr (EntryOf<Key>::isArray)
+        {
+            return std::span<ValueOf<Key>, EntryOf<Key>::dim>(
+                Slot<Key>(), EntryOf<Key>::dim);
+        }
+        else
+        {
+            return *Slot<Key>();
+        }
+    }
+
+    template <auto Key>
+    void Set(const ParamOf<Key>& value)
+    {
+        if constexpr (EntryOf<Key>::isArray)
+        {
+            std::copy_n(value, EntryOf<Key>::dim, Slot<Key>());
+        }
+        else
+        {
+            *Slot<Key>() = value;
+        }
+        indexer_.mask[Layout::template ordinalOf<Key>] = true;
+        MarkDirty(Layout::template ordinalOf<Key>);
+    }
+
+    template <auto Key>
+    bool Has() const
+    {
+        return indexer_.mask[Layout::template ordinalOf<Key>];
+    }
+
+    // 按序列化格式写出,out至少为SerializedBytes()字节,可由DataTableView原地读取
+    constexpr static size_t SerializedBytes() { return Layout::serializedBytes; }
+
+    bool Serialize(void* out, size_t len) const
+    {
+        if (len < Layout::serializedBytes)
+        {
+            return false;
+        }
+        char* dst = reinterpret_cast<char*>(out);
+        std::fill_n(dst, Layout::serializedBytes, 0);
+        std::copy_n(reinterpret_cast<const char*>(&Layout::header), sizeof(TableHeader), dst);
+        std::copy_n(regions_.Data(), RegionsType::bytes, dst + Layout::regionOffset);
+        uint64_t words[Layout::maskWords]{};
+        for (size_t ordinal = 0; ordinal < Es::size; ++ordinal)
+        {
+            words[ordinal / 64] |= uint64_t{indexer_.mask[ordinal]} << (ordinal % 64);
+        }
+        std::copy_n(reinterpret_cast<const char*>(words), sizeof(words), dst + Layout::maskOffset);
+        return true;
+    }
+
+    // 批量读写:编译期键列表,out/in为按键列表顺序紧密排列的缓冲区
+    // 任一记录未设置时GetMany返回false且不写出
+    template <auto... Keys>
+    bool GetMany(void* out) const
+    {
+        if (!(Has<Keys>() && ...))
         {
             return false;
         }
-        indexer_.mask[key] =
-            regions_.SetData(indexer_.keyToId[key], value, len);
-        return indexer_.mask[key];
+        constexpr auto& plan = batchPlan_<Keys...>;
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            (std::copy_n(regions_.Data() + plan.moves[I].slot, plan.moves[I].size,
+                         reinterpret_cast<char*>(out) + plan.moves[I].packed),
+             ...);
+        }(std::make_index_sequence<plan.count>{});
+        return true;
+    }
+
+    template <auto... Keys>
+    void SetMany(const void* in)
+    {
+        constexpr auto& plan = batchPlan_<Keys...>;
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            (std::copy_n(reinterpret_cast<const char*>(in) + plan.moves[I].packed,
+                         plan.moves[I].size, regions_.Data() + plan.moves[I].slot),
+             ...);
+        }(std::make_index_sequence<plan.count>{});
+        ((indexer_.mask[Layout::template ordinalOf<Keys>] = true), ...);
+        (MarkDirty(Layout::template ordinalOf<Keys>), ...);
+    }
+
+    // 以tuple承载批量读写,数组记录对应std::array
+    template <auto Key>
+    using ElemOf = std::conditional_t<EntryOf<Key>::isArray,
+                                      std::array<ValueOf<Key>, EntryOf<Key>::dim>,
+                                      ValueOf<Key>>;
+
+    template <auto... Keys>
+    bool GetMany(std::tuple<ElemOf<Keys>...>& out) const
+    {
+        if (!(Has<Keys>() && ...))
+        {
+            return false;
+        }
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            (std::copy_n(reinterpret_cast<const char*>(Slot<Keys>()), sizeof(ElemOf<Keys>),
+                         reinterpret_cast<char*>(&std::get<I>(out))),
+             ...);
+        }(std::index_sequence_for<decltype(Keys)...>{});
+        return true;
+    }
+
+    template <auto... Keys>
+    void SetMany(const std::tuple<ElemOf<Keys>...>& in)
+    {
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            (std::copy_n(reinterpret_cast<const char*>(&std::get<I>(in)), sizeof(ElemOf<Keys>),
+                         reinterpret_cast<char*>(Slot<Keys>())),
+             ...);
+        }(std::index_sequence_for<decltype(Keys)...>{});
+        ((indexer_.mask[Layout::template ordinalOf<Keys>] = true), ...);
+        (MarkDirty(Layout::template ordinalOf<Keys>), ...);
+    }
+
+    // 运行期键列表:构建时一次性校验并生成计划,可在多条消息间复用
+    class Batch
+    {
+        friend DataTable;
+        BatchPlan<Es::size> plan_;
+        std::bitset<Es::size> mask_;
+        std::array<uint64_t, Layout::maskWords> words_;
+
+        Batch(const BatchPlan<Es::size>& plan, const std::bitset<Es::size>& mask,
+              const std::array<uint64_t, Layout::maskWords>& words)
+            : plan_(plan), mask_(mask), words_(words)
+        {
+        }
+
+    public:
+        // 打包缓冲区所需字节数
+        size_t Bytes() const { return plan_.bytes; }
+    };
+
+    // 键列表须互不重复:打包缓冲区按列表顺序为每个键各留一段,重复键对应的多段写入同一记录时无法确定取哪段
+    // 存在越界键或重复键时返回std::nullopt
+    static std::optional<Batch> MakeBatch(std::span<const size_t> keys)
+    {
+        // 键数超过记录数时必有重复
+        if (keys.size() > Es::size)
+        {
+            return std::nullopt;
+        }
+        RegionSlot slots[Es::size];
+        std::bitset<Es::size> mask;
+        std::array<uint64_t, Layout::maskWords> words{};
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            size_t ordinal = Layout::OrdinalOf(keys[i]);
+            if (ordinal >= Es::size || mask[ordinal])
+            {
+                return std::nullopt;
+            }
+            slots[i] = slots_[ordinal];
+            mask[ordinal] = true;
+            words[ordinal / 64] |= uint64_t{1} << (ordinal % 64);
+        }
+        return Batch(BatchPlan<Es::size>(slots, keys.size()), mask, words);
+    }
+
+    bool GetMany(const Batch& batch, void* out) const
+    {
+        if ((indexer_.mask & batch.mask_) != batch.mask_)
+        {
+            return false;
+        }
+        for (size_t i = 0; i < batch.plan_.count; ++i)
+        {
+            const BatchMove& move = batch.plan_.moves[i];
+            CopySlot(reinterpret_cast<char*>(out) + move.packed,
+                     regions_.Data() + move.slot, move.size);
+        }
+        return true;
+    }
+
+    void SetMany(const Batch& batch, const void* in)
+    {
+        for (size_t i = 0; i < batch.plan_.count; ++i)
+        {
+            const BatchMove& move = batch.plan_.moves[i];
+            CopySlot(regions_.Data() + move.slot,
+                     reinterpret_cast<const char*>(in) + move.packed, move.size);
+        }
+        indexer_.mask |= batch.mask_;
+        for (size_t i = 0; i < dirty_.size(); ++i)
+        {
+            dirty_[i] |= batch.words_[i];
+        }
+    }
+
+    // 脏记录跟踪:经SetData/Set/SetMany写入的记录被标记,经Ref修改的不会
+    template <auto Key>
+    bool IsDirty() const
+    {
+        constexpr size_t ordinal = Layout::template ordinalOf<Key>;
+        return dirty_[ordinal / 64] >> (ordinal % 64) & 1;
+    }
+
+    size_t DirtyCount() const
+    {
+        size_t count = 0;
+        for (uint64_t word : dirty_)
+        {
+            count += std::popcount(word);
+        }
+        return count;
+    }
+
+    void ClearDirty() { dirty_.fill(0); }
+
+    // 导出全部脏记录所需的字节数
+    size_t DeltaBytes() const
+    {
+        size_t bytes = sizeof(DeltaHeader);
+        ForEachDirty([&](size_t ordinal) { bytes += sizeof(DeltaRecord) + slots_[ordinal].size; });
+        return bytes;
+    }
+
+    // 导出增量并清除脏标记,返回写出的字节数;缓冲区不足时返回0且保留脏标记
+    size_t ExportDelta(void* out, size_t len)
+    {
+        size_t bytes = DeltaBytes();
+        if (len < bytes)
+        {
+            return 0;
+        }
+        char* pos = reinterpret_cast<char*>(out) + sizeof(DeltaHeader);
+        DeltaHeader header{Layout::schemaHash, 0, static_cast<uint32_t>(bytes)};
+        ForEachDirty([&](size_t ordinal) {
+            const RegionSlot& slot = slots_[ordinal];
+            DeltaRecord record{static_cast<uint32_t>(ordinal), static_cast<uint32_t>(slot.size)};
+            pos = std::copy_n(reinterpret_cast<const char*>(&record), sizeof(record), pos);
+            CopySlot(pos, regions_.Data() + slot.offset, slot.size);
+            pos += slot.size;
+            ++header.count;
+        });
+        std::copy_n(reinterpret_cast<const char*>(&header), sizeof(header), reinterpret_cast<char*>(out));
+        ClearDirty();
+        return bytes;
+    }
+
+    // 应用ExportDelta的输出;先整体校验,任一处不合法时不做任何修改;
+    // 应用的记录不标脏,转发本表增量时不会回传刚收到的内容
+    bool ApplyDelta(const void* in, size_t len)
+    {
+        const char* base = reinterpret_cast<const char*>(in);
+        DeltaHeader header;
+        if (len < sizeof(header))
+        {
+            return false;
+        }
+        std::copy_n(base, sizeof(header), reinterpret_cast<char*>(&header));
+        if (header.schemaHash != Layout::schemaHash || header.bytes > len)
+        {
+            return false;
+        }
+        for (int apply = 0; apply < 2; ++apply)
+        {
+            size_t pos = sizeof(header);
+            for (uint32_t i = 0; i < header.count; ++i)
+            {
+                DeltaRecord record;
+                if (pos + sizeof(record) > header.bytes)
+                {
+                    return false;
+                }
+                std::copy_n(base + pos, sizeof(record), reinterpret_cast<char*>(&record));
+                pos += sizeof(record);
+                if (record.ordinal >= Es::size || record.size != slots_[record.ordinal].size ||
+                    pos + record.size > header.bytes)
+                {
+                    return false;
+                }
+                if (apply)
+                {
+                    StoreOrdinal(record.ordinal, base + pos, record.size);
+                }
+                pos += record.size;
+            }
+        }
+        return true;
     }
 };
 #endif // !DATA_TABLE_H
\ No newline at end of file
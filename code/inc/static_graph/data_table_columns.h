@@ -0,0 +1,402 @@
+/*	Copyright(C)
+    Author: 479764650@qq.com
+    Description: 列式(SoA)多行KV数据表,提供列扫描算子
+    History: 2026/10/17
+*/
+
+#ifndef DATA_TABLE_COLUMNS_H
+#define DATA_TABLE_COLUMNS_H
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "data_table.h"
+
+// 列式数据表:与DataTable使用同一组Entry描述,每个记录独占一段连续且按缓存行对齐的列
+// 数组记录在列内按行连续存放dim个元素
+template <TL Es>
+class DataTableColumns
+{
+private:
+    constexpr static size_t entriesNum = Es::size;
+    constexpr static size_t columnAlign = 64;
+
+    using KeyMap = KeyMapTrait<Es>;
+
+    template <auto Key>
+    using EntryOf = KeyIndexTrait_t<Es, Key>;
+    template <auto Key>
+    using ValueOf = typename EntryOf<Key>::type;
+    template <auto Key>
+    using ParamOf = std::conditional_t<EntryOf<Key>::isArray,
+                                       ValueOf<Key>[EntryOf<Key>::dim],
+                                       ValueOf<Key>>;
+    // 数值列扫描时的累加类型
+    template <typename T>
+    using SumOf = std::conditional_t<std::is_floating_point_v<T>, double,
+                                     std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>>;
+
+    // 序号 -> 每行字节数
+    template <typename... Entries>
+    struct RowSizeTable
+    {
+        constexpr static std::array<size_t, entriesNum> value = [] {
+            std::array<size_t, entriesNum> result{};
+            ((result[KeyMap::template ordinalOf<Entries::key>] = sizeof(typename Entries::type) * Entries::dim),
+             ...);
+            return result;
+        }();
+    };
+    constexpr static auto& rowSizes_ = Es::template exportTo<RowSizeTable>::value;
+
+    std::array<char*, entriesNum> columns_{};
+    std::vector<std::bitset<entriesNum>> masks_;
+    size_t capacity_ = 0;
+
+    template <auto Key>
+    ValueOf<Key>* Column()
+    {
+        return reinterpret_cast<ValueOf<Key>*>(columns_[KeyMap::template ordinalOf<Key>]);
+    }
+
+    template <auto Key>
+    const ValueOf<Key>* Column() const
+    {
+        return reinterpret_cast<const ValueOf<Key>*>(columns_[KeyMap::template ordinalOf<Key>]);
+    }
+
+    template <auto Key>
+    constexpr static void RequireNumeric()
+    {
+        static_assert(!EntryOf<Key>::isArray && std::is_arithmetic_v<ValueOf<Key>>,
+                      "column kernels require numeric scalar entries");
+    }
+
+    void Reserve(size_t rows)
+    {
+        if (rows <= capacity_)
+        {
+            return;
+        }
+        size_t capacity = std::max(rows, capacity_ * 2);
+        for (size_t ordinal = 0; ordinal < entriesNum; ++ordinal)
+        {
+            char* column = static_cast<char*>(
+                ::operator new(capacity * rowSizes_[ordinal], std::align_val_t{columnAlign}));
+            std::fill_n(std::copy_n(columns_[ordinal], Rows() * rowSizes_[ordinal], column),
+                        (capacity - Rows()) * rowSizes_[ordinal], 0);
+            Release(ordinal);
+            columns_[ordinal] = column;
+        }
+        capacity_ = capacity;
+    }
+
+    void Release(size_t ordinal)
+    {
+        if (columns_[ordinal])
+        {
+            ::operator delete(columns_[ordinal], std::align_val_t{columnAlign});
+            columns_[ordinal] = nullptr;
+        }
+    }
+
+public:
+    // 行视图:接口与单行DataTable一致
+    class RowView
+    {
+        friend DataTableColumns;
+        DataTableColumns* table_;
+        size_t row_;
+
+        RowView(DataTableColumns* table, size_t row) : table_(table), row_(row) {}
+
+        bool GetOrdinal(size_t ordinal, void* out, size_t len) const
+        {
+            if (ordinal >= entriesNum || !table_->masks_[row_][ordinal])
+            {
+                return false;
+            }
+            size_t size = rowSizes_[ordinal];
+            CopySlot(reinterpret_cast<char*>(out), table_->columns_[ordinal] + row_ * size,
+                     std::min(len, size));
+            return true;
+        }
+
+        bool SetOrdinal(size_t ordinal, const void* value, size_t len)
+        {
+            if (ordinal >= entriesNum)
+            {
+                return false;
+            }
+            size_t size = rowSizes_[ordinal];
+            CopySlot(table_->columns_[ordinal] + row_ * size, reinterpret_cast<const char*>(value),
+                     std::min(len, size));
+            table_->masks_[row_][ordinal] = true;
+            return true;
+        }
+
+    public:
+        size_t Row() const { return row_; }
+
+        bool GetData(size_t key, void* out, size_t len = -1) const
+        {
+            return GetOrdinal(KeyMap::OrdinalOf(key), out, len);
+        }
+        bool GetData(std::string_view name, void* out, size_t len = -1) const
+        {
+            return GetOrdinal(KeyMap::OrdinalOf(name), out, len);
+        }
+
+        bool SetData(size_t key, const void* value, size_t len = -1)
+        {
+            return SetOrdinal(KeyMap::OrdinalOf(key), value, len);
+        }
+        bool SetData(std::string_view name, const void* value, size_t len = -1)
+        {
+            return SetOrdinal(KeyMap::OrdinalOf(name), value, len);
+        }
+
+        template <auto Key>
+        auto Get() const
+        {
+            constexpr size_t dim = EntryOf<Key>::dim;
+            const ValueOf<Key>* slot = table_->template Column<Key>() + row_ * dim;
+            if constexpr (EntryOf<Key>::isArray)
+            {
+                return std::span<const ValueOf<Key>, dim>(slot, dim);
+            }
+            else
+            {
+                return *slot;
+            }
+        }
+
+        template <auto Key>
+        decltype(auto) Ref()
+        {
+            constexpr size_t dim = EntryOf<Key>::dim;
+            ValueOf<Key>* slot = table_->template Column<Key>() + row_ * dim;
+            if constexpr (EntryOf<Key>::isArray)
+            {
+                return std::span<ValueOf<Key>, dim>(slot, dim);
+            }
+            else
+            {
+                return *slot;
+            }
+        }
+
+        template <auto Key>
+        void Set(const ParamOf<Key>& value)
+        {
+            constexpr size_t dim = EntryOf<Key>::dim;
+            ValueOf<Key>* slot = table_->template Column<Key>() + row_ * dim;
+            if constexpr (EntryOf<Key>::isArray)
+            {
+                std::copy_n(value, dim, slot);
+            }
+            else
+            {
+                *slot = value;
+            }
+            table_->masks_[row_][KeyMap::template ordinalOf<Key>] = true;
+        }
+
+        template <auto Key>
+        bool Has() const
+        {
+            return table_->masks_[row_][KeyMap::template ordinalOf<Key>];
+        }
+    };
+
+    DataTableColumns() = default;
+    DataTableColumns(const DataTableColumns&) = delete;
+    DataTableColumns& operator=(const DataTableColumns&) = delete;
+
+    // 移动只转移各列的所有权,源对象变为空表;指向源对象的RowView随之失效
+    DataTableColumns(DataTableColumns&& other) noexcept
+        : columns_(std::exchange(other.columns_, {})),
+          masks_(std::move(other.masks_)),
+          capacity_(std::exchange(other.capacity_, 0))
+    {
+        other.masks_.clear();
+    }
+
+    DataTableColumns& operator=(DataTableColumns&& other) noexcept
+    {
+        if (this != &other)
+        {
+            for (size_t ordinal = 0; ordinal < entriesNum; ++ordinal)
+            {
+                Release(ordinal);
+            }
+            columns_ = std::exchange(other.columns_, {});
+            masks_ = std::move(other.masks_);
+            other.masks_.clear();
+            capacity_ = std::exchange(other.capacity_, 0);
+        }
+        return *this;
+    }
+
+    ~DataTableColumns()
+    {
+        for (size_t ordinal = 0; ordinal < entriesNum; ++ordinal)
+        {
+            Release(ordinal);
+        }
+    }
+
+    size_t Rows() const { return masks_.size(); }
+
+    // 追加一行,各记录初始为零且未设置
+    RowView Append()
+    {
+        Reserve(Rows() + 1);
+        masks_.emplace_back();
+        return RowView(this, Rows() - 1);
+    }
+
+    // 删除一行,后续行整体前移以保持行序
+    void Erase(size_t row)
+    {
+        if (row >= Rows())
+        {
+            return;
+        }
+        for (size_t ordinal = 0; ordinal < entriesNum; ++ordinal)
+        {
+            size_t size = rowSizes_[ordinal];
+            char* column = columns_[ordinal];
+            std::copy(column + (row + 1) * size, column + Rows() * size, column + row * size);
+            std::fill_n(column + (Rows() - 1) * size, size, 0);
+        }
+        masks_.erase(masks_.begin() + row);
+    }
+
+    RowView Row(size_t row) { return RowView(this, row); }
+
+    // 整列视图,数组记录为rows * dim个元素
+    template <auto Key>
+    std::span<const ValueOf<Key>> ColumnView() const
+    {
+        return {Column<Key>(), Rows() * EntryOf<Key>::dim};
+    }
+
+    // 列扫描算子:仅适用于数值标量记录,未设置的记录按零参与计算
+    // 使用多路独立累加,便于编译器向量化
+    template <auto Key>
+    SumOf<ValueOf<Key>> Sum() const
+    {
+        RequireNumeric<Key>();
+        constexpr size_t lanes = 8;
+        const ValueOf<Key>* column = Column<Key>();
+        size_t rows = Rows();
+        SumOf<ValueOf<Key>> acc[lanes]{};
+        size_t i = 0;
+        for (; i + lanes <= rows; i += lanes)
+        {
+            for (size_t lane = 0; lane < lanes; ++lane)
+            {
+                acc[lane] += column[i + lane];
+            }
+        }
+        for (; i < rows; ++i)
+        {
+            acc[0] += column[i];
+        }
+        SumOf<ValueOf<Key>> result{};
+        for (size_t lane = 0; lane < lanes; ++lane)
+        {
+            result += acc[lane];
+        }
+        return result;
+    }
+
+    template <auto Key>
+    std::optional<ValueOf<Key>> Min() const
+    {
+        RequireNumeric<Key>();
+        return Reduce<Key>([](auto a, auto b) { return b < a ? b : a; });
+    }
+
+    template <auto Key>
+    std::optional<ValueOf<Key>> Max() const
+    {
+        RequireNumeric<Key>();
+        return Reduce<Key>([](auto a, auto b) { return a < b ? b : a; });
+    }
+
+    template <auto Key, typename Pred>
+    size_t CountWhere(Pred&& pred) const
+    {
+        RequireNumeric<Key>();
+        const ValueOf<Key>* column = Column<Key>();
+        size_t rows = Rows();
+        size_t count = 0;
+        for (size_t i = 0; i < rows; ++i)
+        {
+            count += static_cast<bool>(pred(column[i]));
+        }
+        return count;
+    }
+
+    // 返回满足条件的行号,写出无分支
+    template <auto Key, typename Pred>
+    std::vector<size_t> Filter(Pred&& pred) const
+    {
+        RequireNumeric<Key>();
+        const ValueOf<Key>* column = Column<Key>();
+        size_t rows = Rows();
+        std::vector<size_t> result(rows);
+        size_t count = 0;
+        for (size_t i = 0; i < rows; ++i)
+        {
+            result[count] = i;
+            count += static_cast<bool>(pred(column[i]));
+        }
+        result.resize(count);
+        return result;
+    }
+
+private:
+    template <auto Key, typename Op>
+    std::optional<ValueOf<Key>> Reduce(Op op) const
+    {
+        constexpr size_t lanes = 8;
+        const ValueOf<Key>* column = Column<Key>();
+        size_t rows = Rows();
+        if (rows == 0)
+        {
+            return std::nullopt;
+        }
+        ValueOf<Key> acc[lanes];
+        std::fill_n(acc, lanes, column[0]);
+        size_t i = 0;
+        for (; i + lanes <= rows; i += lanes)
+        {
+            for (size_t lane = 0; lane < lanes; ++lane)
+            {
+                acc[lane] = op(acc[lane], column[i + lane]);
+            }
+        }
+        for (; i < rows; ++i)
+        {
+            acc[0] = op(acc[0], column[i]);
+        }
+        for (size_t lane = 1; lane < lanes; ++lane)
+        {
+            acc[0] = op(acc[0], acc[lane]);
+        }
+        return acc[0];
+    }
+};
+
+#endif // !DATA_TABLE_COLUMNS_H
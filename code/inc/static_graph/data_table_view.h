@@ -0,0 +1,157 @@
+/*	Copyright(C)
+    Author: 479764650@qq.com
+    Description: 序列化KV数据表的只读视图,可直接覆盖在mmap文件或网络缓冲区上原地读取
+    History: 2026/10/17
+*/
+
+#ifndef DATA_TABLE_VIEW_H
+#define DATA_TABLE_VIEW_H
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include "data_table.h"
+
+// 格式见DataTableLayout,由DataTable::Serialize写出
+// 视图不持有数据,仅在Attach时校验头部,之后的读取不做任何反序列化
+// Policy须与写出数据的DataTable一致,不一致时schemaHash不同,Attach失败
+template <TL Es, typename Policy = PackedLayout>
+class DataTableView
+{
+private:
+    using Layout = DataTableLayout<Es, Policy>;
+
+    template <auto Key>
+    using EntryOf = typename Layout::template EntryOf<Key>;
+    template <auto Key>
+    using ValueOf = typename Layout::template ValueOf<Key>;
+
+    const char* data_;
+
+    explicit DataTableView(const char* data) : data_(data) {}
+
+    template <auto Key>
+    const ValueOf<Key>* Slot() const
+    {
+        return reinterpret_cast<const ValueOf<Key>*>(data_ + Layout::regionOffset +
+                                                     Layout::template slotOf<Key>.offset);
+    }
+
+    bool Present(size_t ordinal) const
+    {
+        const uint64_t* words = reinterpret_cast<const uint64_t*>(data_ + Layout::maskOffset);
+        return words[ordinal / 64] >> (ordinal % 64) & 1;
+    }
+
+    bool GetOrdinal(size_t ordinal, void* out, size_t len) const
+    {
+        if (ordinal >= Es::size || !Present(ordinal))
+        {
+            return false;
+        }
+        const RegionSlot& slot = Layout::slots[ordinal];
+        CopySlot(reinterpret_cast<char*>(out), data_ + Layout::regionOffset + slot.offset,
+                 std::min(len, slot.size));
+        return true;
+    }
+
+    bool GetRangeOrdinal(size_t ordinal, size_t first, size_t count, void* out) const
+    {
+        auto range = Layout::ElementsOf(ordinal, first, count);
+        if (!range || !Present(ordinal))
+        {
+            return false;
+        }
+        CopySlot(reinterpret_cast<char*>(out), data_ + Layout::regionOffset + range->offset, range->size);
+        return true;
+    }
+
+public:
+    // 单个表序列化后的字节数,多个表首尾相接时的步长
+    constexpr static size_t bytes = Layout::serializedBytes;
+    constexpr static size_t alignment = Layout::serialAlign;
+
+    // 长度不足、未按alignment对齐或头部与当前Entry描述不一致时返回std::nullopt
+    static std::optional<DataTableView> Attach(const void* data, size_t len)
+    {
+        const char* base = reinterpret_cast<const char*>(data);
+        if (base == nullptr || len < bytes || reinterpret_cast<uintptr_t>(base) % alignment != 0)
+        {
+            return std::nullopt;
+        }
+        const TableHeader& header = *reinterpret_cast<const TableHeader*>(base);
+        const TableHeader& expected = Layout::header;
+        if (header.magic != expected.magic || header.version != expected.version ||
+            header.schemaHash != expected.schemaHash || header.regionBytes != expected.regionBytes ||
+            header.maskWords != expected.maskWords)
+        {
+            return std::nullopt;
+        }
+        return DataTableView(base);
+    }
+
+    // 首尾相接存放的第nth个表
+    static std::optional<DataTableView> Attach(const void* data, size_t len, size_t nth)
+    {
+        if (nth >= len / bytes)
+        {
+            return std::nullopt;
+        }
+        return Attach(reinterpret_cast<const char*>(data) + nth * bytes, bytes);
+    }
+
+    bool GetData(size_t key, void* out, size_t len = -1) const
+    {
+        return GetOrdinal(Layout::OrdinalOf(key), out, len);
+    }
+    bool GetData(std::string_view name, void* out, size_t len = -1) const
+    {
+        return GetOrdinal(Layout::OrdinalOf(name), out, len);
+    }
+
+    // 数组记录的部分读取,语义同DataTable::GetRange/Get(key, i, out)
+    bool GetRange(size_t key, size_t first, size_t count, void* out) const
+    {
+        return GetRangeOrdinal(Layout::OrdinalOf(key), first, count, out);
+    }
+    bool GetRange(std::string_view name, size_t first, size_t count, void* out) const
+    {
+        return GetRangeOrdinal(Layout::OrdinalOf(name), first, count, out);
+    }
+
+    template <typename T>
+    bool Get(size_t key, size_t i, T& out) const
+    {
+        size_t ordinal = Layout::OrdinalOf(key);
+        return Layout::template ElemIs<T>(ordinal) && GetRangeOrdinal(ordinal, i, 1, &out);
+    }
+    template <typename T>
+    bool Get(std::string_view name, size_t i, T& out) const
+    {
+        size_t ordinal = Layout::OrdinalOf(name);
+        return Layout::template ElemIs<T>(ordinal) && GetRangeOrdinal(ordinal, i, 1, &out);
+    }
+
+    template <auto Key>
+    auto Get() const
+    {
+        if constexpr (EntryOf<Key>::isArray)
+        {
+            return std::span<const ValueOf<Key>, EntryOf<Key>::dim>(Slot<Key>(), EntryOf<Key>::dim);
+        }
+        else
+        {
+            return *Slot<Key>();
+        }
+    }
+
+    template <auto Key>
+    bool Has() const
+    {
+        return Present(Layout::template ordinalOf<Key>);
+    }
+};
+
+#endif // !DATA_TABLE_VIEW_H
@@ -8,6 +8,11 @@
 #define FIXED_STRING_H
 
 #include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
 
 template <size_t N>
 struct FixedString
@@ -15,8 +20,96 @@ struct FixedString
     char str[N];
     // FixString对象将拥有静态存储期,同一个字面对象在程序中仅有一个实例
     constexpr FixedString(const char (&s)[N]) { std::copy_n(s, N, str); }
+    // 不含结尾的'\0'
+    constexpr std::string_view View() const { return {str, N - 1}; }
 };
 
+template <typename T>
+struct IsFixedString : std::false_type
+{
+};
+
+template <size_t N>
+struct IsFixedString<FixedString<N>> : std::true_type
+{
+};
+
+// 从name[pos]起按小端读取Bytes个字节,编译期逐字节拼装,运行期为一次定长加载
+template <size_t Bytes>
+constexpr uint64_t LoadLittle(std::string_view name, size_t pos)
+{
+    if (!std::is_constant_evaluated() && std::endian::native == std::endian::little)
+    {
+        std::conditional_t<Bytes == 8, uint64_t, uint32_t> word;
+        std::memcpy(&word, name.data() + pos, Bytes);
+        return word;
+    }
+    uint64_t word = 0;
+    for (size_t i = 0; i < Bytes; ++i)
+    {
+        word |= uint64_t{static_cast<unsigned char>(name[pos + i])} << (i * 8);
+    }
+    return word;
+}
+
+// 名字的64位哈希:按8字节吸收,尾部用重叠加载,避免逐字节循环
+constexpr uint64_t NameHash(std::string_view name)
+{
+    uint64_t hash = 0x9E3779B97F4A7C15ull ^ name.size();
+    auto absorb = [&hash](uint64_t word) {
+        hash = (hash ^ word) * 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 32;
+    };
+    size_t size = name.size();
+    if (size >= 8)
+    {
+        for (size_t i = 0; i + 8 < size; i += 8)
+        {
+            absorb(LoadLittle<8>(name, i));
+        }
+        absorb(LoadLittle<8>(name, size - 8));
+    }
+    else if (size >= 4)
+    {
+        absorb(LoadLittle<4>(name, 0) | LoadLittle<4>(name, size - 4) << 32);
+    }
+    else
+    {
+        uint64_t word = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            word |= uint64_t{static_cast<unsigned char>(name[i])} << (i * 8);
+        }
+        absorb(word);
+    }
+    return hash;
+}
+
+// 名字相等比较,与NameHash相同的分块方式,避免对短名字调用memcmp
+constexpr bool SameName(std::string_view a, std::string_view b)
+{
+    size_t size = a.size();
+    if (size != b.size())
+    {
+        return false;
+    }
+    if (size < 4)
+    {
+        return a == b;
+    }
+    if (size < 8)
+    {
+        return LoadLittle<4>(a, 0) == LoadLittle<4>(b, 0) &&
+               LoadLittle<4>(a, size - 4) == LoadLittle<4>(b, size - 4);
+    }
+    uint64_t diff = 0;
+    for (size_t i = 0; i + 8 < size; i += 8)
+    {
+        diff |= LoadLittle<8>(a, i) ^ LoadLittle<8>(b, i);
+    }
+    return (diff | (LoadLittle<8>(a, size - 8) ^ LoadLittle<8>(b, size - 8))) == 0;
+}
+
 template <FixedString STR>
 constexpr decltype(STR) operator""_fs()
 {
@@ -7,26 +7,63 @@
 #ifndef GRAPH_H
 #define GRAPH_H
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <string_view>
 #include <type_traits>
 #include <utility>
+#include "fixed_string.h"
+#include "perfect_hash.h"
 #include "type_list.h"
 
-// 顶点
-template <char Id>
+// 顶点,id可为整型、枚举或FixedString,编译期重映射为稠密序号[0, V)
+template <auto Id>
+    requires(std::is_integral_v<decltype(Id)> || std::is_enum_v<decltype(Id)> ||
+             IsFixedString<std::remove_cv_t<decltype(Id)>>::value)
 struct Node
 {
-    constexpr static char id = Id;
+    constexpr static auto id = Id;
 };
 
 template <typename Node>
 concept Vertex = requires { Node::id; };
 
-// 边及萃取
-template <Vertex F, Vertex T>
+// 顶点id在运行期接口中的类型:名字统一为std::string_view,其余为id本身的类型
+template <typename Id>
+using NodeIdType_t = std::conditional_t<IsFixedString<Id>::value, std::string_view, Id>;
+
+template <Vertex N>
+constexpr NodeIdType_t<std::decay_t<decltype(N::id)>> NodeIdOf()
+{
+    if constexpr (IsFixedString<std::decay_t<decltype(N::id)>>::value)
+    {
+        return N::id.View();
+    }
+    else
+    {
+        return N::id;
+    }
+}
+
+// 顶点的稠密序号,运行期接口既可传顶点id也可传序号
+struct NodeOrdinal
+{
+    size_t value;
+};
+
+// 边及萃取,Weight为边权,须为正数
+template <Vertex F, Vertex T, size_t Weight = 1>
+    requires(Weight > 0)
 struct Edge
 {
     using From = F;
     using To = T;
+    constexpr static size_t weight = Weight;
 };
 
 template <typename Node = void>
@@ -44,7 +81,15 @@ struct EdgeTrait
 };
 
 // 链及模板解析
+// 带权的边在两个顶点之间插入COST:LINK(NODE(A)->COST(5)->NODE(B)),未标注时边权为1
+template <size_t W>
+struct Weight
+{
+    constexpr static size_t value = W;
+};
+
 #define NODE(node_name) auto (*)(node_name)
+#define COST(weight) auto (*)(Weight<weight>)
 #define LINK(link) link->void
 
 template <typename Link, TL Out = TypeList<>>
@@ -67,6 +112,16 @@ public:
     using type = typename Chain<T, typename Out::template append<Edge<From, To>>>::type;
 };
 
+template <Vertex F, size_t W, typename T, TL Out>
+class Chain<auto (*)(F)->auto (*)(Weight<W>)->T, Out>
+{
+    using To = typename Chain<T, Out>::From;
+
+public:
+    using From = F;
+    using type = typename Chain<T, typename Out::template append<Edge<From, To, W>>>::type;
+};
+
 template <typename Link>
 using Chain_t = typename Chain<Link>::type;
 
@@ -78,120 +133,1149 @@ struct PathRef
     size_t sz;
 };
 
-// 静态图
-template <typename... Chains>
-class Graph
+// 带总代价的路径
+template <typename NodeType>
+struct WeightedPathRef : PathRef<NodeType>
+{
+    size_t cost;
+};
+
+// 顶点处理器:顶点类型提供静态的Handle(state),由Graph::Run沿路径依次调用
+template <typename N, typename State>
+concept NodeHandler = Vertex<N> && requires(State& state) { N::Handle(state); };
+
+// N个顶点的集合,按64位字存放;各操作为定长字数组上的无分支循环,便于编译器向量化
+template <size_t N>
+class NodeSet
+{
+public:
+    constexpr static size_t wordsNum = (N + 63) / 64;
+
+    constexpr bool Test(size_t ordinal) const { return ordinal < N && (words_[ordinal / 64] >> (ordinal % 64) & 1); }
+    constexpr void Set(size_t ordinal) { words_[ordinal / 64] |= uint64_t{1} << (ordinal % 64); }
+    constexpr void Reset(size_t ordinal) { words_[ordinal / 64] &= ~(uint64_t{1} << (ordinal % 64)); }
+
+    constexpr size_t Count() const
+    {
+        size_t count = 0;
+        for (uint64_t word : words_)
+        {
+            count += static_cast<size_t>(std::popcount(word));
+        }
+        return count;
+    }
+
+    constexpr bool Any() const
+    {
+        uint64_t any = 0;
+        for (uint64_t word : words_)
+        {
+            any |= word;
+        }
+        return any != 0;
+    }
+
+    constexpr bool None() const { return !Any(); }
+
+    // 交集的元素数,不生成中间集合
+    constexpr size_t CountCommon(const NodeSet& other) const
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < wordsNum; ++i)
+        {
+            count += static_cast<size_t>(std::popcount(words_[i] & other.words_[i]));
+        }
+        return count;
+    }
+
+    constexpr bool Intersects(const NodeSet& other) const
+    {
+        uint64_t common = 0;
+        for (size_t i = 0; i < wordsNum; ++i)
+        {
+            common |= words_[i] & other.words_[i];
+        }
+        return common != 0;
+    }
+
+    // other是否为本集合的子集
+    constexpr bool Contains(const NodeSet& other) const
+    {
+        uint64_t missing = 0;
+        for (size_t i = 0; i < wordsNum; ++i)
+        {
+            missing |= other.words_[i] & ~words_[i];
+        }
+        return missing == 0;
+    }
+
+    constexpr NodeSet& operator&=(const NodeSet& other)
+    {
+        for (size_t i = 0; i < wordsNum; ++i)
+        {
+            words_[i] &= other.words_[i];
+        }
+        return *this;
+    }
+
+    constexpr NodeSet& operator|=(const NodeSet& other)
+    {
+        for (size_t i = 0; i < wordsNum; ++i)
+        {
+            words_[i] |= other.words_[i];
+        }
+        return *this;
+    }
+
+    friend constexpr NodeSet operator&(NodeSet a, const NodeSet& b) { return a &= b; }
+    friend constexpr NodeSet operator|(NodeSet a, const NodeSet& b) { return a |= b; }
+    friend constexpr bool operator==(const NodeSet&, const NodeSet&) = default;
+
+    // 按序号升序访问每个元素
+    template <typename F>
+    constexpr void ForEach(F&& visit) const
+    {
+        for (size_t i = 0; i < wordsNum; ++i)
+        {
+            for (uint64_t word = words_[i]; word != 0; word &= word - 1)
+            {
+                visit(i * 64 + static_cast<size_t>(std::countr_zero(word)));
+            }
+        }
+    }
+
+    constexpr const uint64_t* Words() const { return words_.data(); }
+
+private:
+    std::array<uint64_t, wordsNum> words_{};
+};
+
+// 惰性路径:沿下一跳表中终点to的一行逐点展开,不分配内存,也不需要为每条路径单独存放顶点
+// next[from]为from去往to的下一跳序号,V表示无路径
+template <typename NodeType, typename Index>
+class Route
 {
 public:
-    template <typename NodeType>
-    constexpr static PathRef<NodeType> GetShortestPath(NodeType from, NodeType to)
+    class Iterator
     {
-        PathRef<NodeType> result{};
-        matchPath(from, to, result, AllSavedPaths{});
+        const Index* next_ = nullptr;
+        const NodeType* ids_ = nullptr;
+        size_t nodesNum_ = 0;
+        size_t to_ = 0;
+        size_t cur_ = 0; // 等于nodesNum_时为末尾
+
+    public:
+        using value_type = NodeType;
+        using difference_type = std::ptrdiff_t;
+
+        constexpr Iterator() = default;
+        constexpr Iterator(const Index* next, const NodeType* ids, size_t nodesNum, size_t from, size_t to)
+            : next_(next), ids_(ids), nodesNum_(nodesNum), to_(to), cur_(from)
+        {
+        }
+
+        constexpr NodeType operator*() const { return ids_[cur_]; }
+        constexpr size_t Ordinal() const { return cur_; }
+
+        constexpr Iterator& operator++()
+        {
+            cur_ = cur_ == to_ ? nodesNum_ : next_[cur_];
+            return *this;
+        }
+        constexpr Iterator operator++(int)
+        {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        constexpr bool operator==(const Iterator& other) const { return cur_ == other.cur_; }
+        constexpr bool operator==(std::default_sentinel_t) const { return cur_ == nodesNum_; }
+    };
+
+    constexpr Route() = default;
+    constexpr Route(const Index* next, const NodeType* ids, size_t nodesNum, size_t from, size_t to)
+        : next_(next), ids_(ids), nodesNum_(nodesNum), from_(from), to_(to)
+    {
+    }
+
+    constexpr Iterator begin() const { return {next_, ids_, nodesNum_, from_, to_}; }
+    constexpr std::default_sentinel_t end() const { return {}; }
+
+    constexpr bool empty() const { return from_ == nodesNum_; }
+
+    // 逐点计数,O(路径长度)
+    constexpr size_t size() const
+    {
+        size_t n = 0;
+        for (Iterator it = begin(); it != end(); ++it)
+        {
+            ++n;
+        }
+        return n;
+    }
+
+private:
+    const Index* next_ = nullptr;
+    const NodeType* ids_ = nullptr;
+    size_t nodesNum_ = 0;
+    size_t from_ = 0; // 等于nodesNum_时为空路径
+    size_t to_ = 0;
+};
+
+// 出边与入边的压缩邻接数组,同一顶点的边保持Edges中的顺序;各成员均为公有数组,可作为非类型模板实参
+// outTo[outStart[v], outStart[v + 1])为v的后继,inFrom[inStart[v], inStart[v + 1])为v的前驱
+template <size_t NodesNum, size_t EdgesNum>
+struct Adjacency
+{
+    // 边按声明顺序的起止序号
+    std::array<size_t, EdgesNum> from{};
+    std::array<size_t, EdgesNum> to{};
+    std::array<size_t, NodesNum + 1> outStart{};
+    std::array<size_t, EdgesNum> outTo{};
+    std::array<size_t, EdgesNum> outWeight{};
+    std::array<size_t, NodesNum + 1> inStart{};
+    std::array<size_t, EdgesNum> inFrom{};
+    std::array<size_t, EdgesNum> inWeight{};
+};
+
+// 按终点分行的路由表,Weighted为false时按跳数,为true时按边权
+// 以邻接数组的值为键而不嵌套在Graph中:每行是一个成员模板特化,若以Graph的顶点类型列表为外层实参,
+// 每次实例化的开销随实参长度增长,V行合计随顶点数立方增长
+template <auto Adj, bool Weighted>
+struct RouteRows
+{
+    constexpr static size_t nodesNum = Adj.outStart.size() - 1;
+    constexpr static size_t edgesNum = Adj.outTo.size();
+    constexpr static size_t unreachable = static_cast<size_t>(-1);
+
+    // 反向图上从to出发的单源最短路,dist[from]为from到to的代价
+    // 编译期求值以指针访问数组,避免每次下标都计为一次函数调用
+    constexpr static void Bfs(size_t to, size_t* dist)
+    {
+        const size_t* inStart = Adj.inStart.data();
+        const size_t* inFrom = Adj.inFrom.data();
+        std::array<size_t, nodesNum> queue{};
+        size_t* head = queue.data();
+        size_t* tail = queue.data();
+        dist[to] = 0;
+        *tail++ = to;
+        while (head < tail)
+        {
+            size_t cur = *head++;
+            for (size_t e = inStart[cur]; e < inStart[cur + 1]; ++e)
+            {
+                size_t prev = inFrom[e];
+                if (dist[prev] == unreachable)
+                {
+                    dist[prev] = dist[cur] + 1;
+                    *tail++ = prev;
+                }
+            }
+        }
+    }
+
+    // 二叉堆按代价出堆,过期元素出堆时跳过
+    constexpr static void Dijkstra(size_t to, size_t* dist)
+    {
+        const size_t* inStart = Adj.inStart.data();
+        const size_t* inFrom = Adj.inFrom.data();
+        const size_t* inWeight = Adj.inWeight.data();
+        std::array<size_t, edgesNum + 1> heapCost{};
+        std::array<size_t, edgesNum + 1> heapNode{};
+        size_t* costs = heapCost.data();
+        size_t* nodes = heapNode.data();
+        size_t size = 0;
+        auto push = [costs, nodes, &size](size_t cost, size_t node) {
+            size_t i = size++;
+            while (i > 0 && costs[(i - 1) / 2] > cost)
+            {
+                costs[i] = costs[(i - 1) / 2];
+                nodes[i] = nodes[(i - 1) / 2];
+                i = (i - 1) / 2;
+            }
+            costs[i] = cost;
+            nodes[i] = node;
+        };
+        auto pop = [costs, nodes, &size] {
+            --size;
+            size_t cost = costs[size];
+            size_t node = nodes[size];
+            size_t i = 0;
+            while (2 * i + 1 < size)
+            {
+                size_t child = 2 * i + 1;
+                child += child + 1 < size && costs[child + 1] < costs[child];
+                if (costs[child] >= cost)
+                {
+                    break;
+                }
+                costs[i] = costs[child];
+                nodes[i] = nodes[child];
+                i = child;
+            }
+            costs[i] = cost;
+            nodes[i] = node;
+        };
+        dist[to] = 0;
+        push(0, to);
+        while (size > 0)
+        {
+            size_t cost = costs[0];
+            size_t cur = nodes[0];
+            pop();
+            if (cost != dist[cur])
+            {
+                continue;
+            }
+            for (size_t e = inStart[cur]; e < inStart[cur + 1]; ++e)
+            {
+                size_t prev = inFrom[e];
+                size_t candidate = cost + inWeight[e];
+                if (candidate < dist[prev])
+                {
+                    dist[prev] = candidate;
+                    push(candidate, prev);
+                }
+            }
+        }
+    }
+
+    // 以to为终点的一行代价,各行分别求值,避免单个常量表达式的求值步数随顶点数立方增长而超限
+    template <size_t To>
+    constexpr static std::array<size_t, nodesNum> distTo = [] {
+        std::array<size_t, nodesNum> result{};
+        result.fill(unreachable);
+        if constexpr (Weighted)
+        {
+            Dijkstra(To, result.data());
+        }
+        else
+        {
+            Bfs(To, result.data());
+        }
+        return result;
+    }();
+
+    // dist[to][from]:from到to的代价,不可达为unreachable;各行为独立的常量,此处只汇集行指针,不拼接为V×V数组
+    constexpr static std::array<const size_t*, nodesNum> dist = []<size_t... Tos>(std::index_sequence<Tos...>) {
+        return std::array<const size_t*, nodesNum>{distTo<Tos>.data()...};
+    }(std::make_index_sequence<nodesNum>{});
+
+    using Hop = SmallestUint_t<nodesNum>;
+
+    // nextTo<To>[from]:去往To的路径上from的后继,取第一条满足 边权 + 后继代价 == 当前代价 的出边;
+    // from == To时为自身,非点对或不可达时为nodesNum
+    template <size_t To>
+    constexpr static std::array<Hop, nodesNum> nextTo = [] {
+        std::array<Hop, nodesNum> result{};
+        Hop* hop = result.data();
+        const size_t* cost = distTo<To>.data();
+        const size_t* outStart = Adj.outStart.data();
+        const size_t* outTo = Adj.outTo.data();
+        const size_t* outWeight = Adj.outWeight.data();
+        // 终点须有入边,起点须有出边,同IsPair
+        bool toHasIn = Adj.inStart[To + 1] > Adj.inStart[To];
+        for (size_t from = 0; from < nodesNum; ++from)
+        {
+            if (cost[from] == unreachable || !toHasIn || outStart[from + 1] == outStart[from])
+            {
+                hop[from] = static_cast<Hop>(nodesNum);
+                continue;
+            }
+            if (from == To)
+            {
+                hop[from] = static_cast<Hop>(from);
+                continue;
+            }
+            size_t e = outStart[from];
+            while (cost[outTo[e]] == unreachable || cost[outTo[e]] + (Weighted ? outWeight[e] : 1) != cost[from])
+            {
+                ++e;
+            }
+            hop[from] = static_cast<Hop>(outTo[e]);
+        }
         return result;
+    }();
+
+    // next[to][from]:运行期使用的下一跳表,行指针指向各行的nextTo
+    constexpr static std::array<const Hop*, nodesNum> next = []<size_t... Tos>(std::index_sequence<Tos...>) {
+        return std::array<const Hop*, nodesNum>{nextTo<Tos>.data()...};
+    }(std::make_index_sequence<nodesNum>{});
+
+    // 路径顶点数,非点对或不可达为0
+    constexpr static size_t LengthOf(size_t from, size_t to)
+    {
+        const Hop* hop = next[to];
+        if (hop[from] == nodesNum)
+        {
+            return 0;
+        }
+        if constexpr (!Weighted)
+        {
+            return dist[to][from] + 1;
+        }
+        size_t length = 1;
+        for (size_t cur = from; cur != to; cur = hop[cur])
+        {
+            ++length;
+        }
+        return length;
     }
+};
 
+// 静态图
+// 路径在编译期以值计算:由Edges构建邻接数组,对每个终点在反向图上求各点代价
+// (按跳数时BFS,按边权时Dijkstra),再从起点沿边声明顺序贪心选取代价恰好递减一条边权的后继,
+// 按跳数时与原穷举实现在多条最短路径中选出同一条
+template <typename... Chains>
+class Graph
+{
 public:
     using Edges = Unique_t<Concat_t<Chain_t<Chains>...>>;
+    using NodeId = NodeIdType_t<std::decay_t<decltype(Head_t<Edges>::From::id)>>;
+    constexpr static size_t edgesNum = Edges::size;
 
-    // 最短路径搜索
-    template <Vertex From, Vertex Target, TL Path = TypeList<>>
-    // 无required时需用分支技巧判断是否有环，参数名不重要时，可以写完typename = void
-    // template<Vertex From, Vertex Target, TL Path = TypeList<>, typename = void>
-    struct PathFinder;
+private:
+    constexpr static size_t unreachable = static_cast<size_t>(-1);
+    constexpr static bool namedIds = std::is_same_v<NodeId, std::string_view>;
 
-    template <Vertex Target, TL Path>
-    struct PathFinder<Target, Target, Path> : Path::template append<Target>
+    template <typename... Es>
+    struct EdgeIds
     {
+        static_assert(((std::is_same_v<decltype(NodeIdOf<typename Es::From>()), NodeId> &&
+                        std::is_same_v<decltype(NodeIdOf<typename Es::To>()), NodeId>) && ...),
+                      "all nodes of a graph must share one id type");
+        constexpr static std::array<NodeId, sizeof...(Es)> from{NodeIdOf<typename Es::From>()...};
+        constexpr static std::array<NodeId, sizeof...(Es)> to{NodeIdOf<typename Es::To>()...};
+        constexpr static std::array<size_t, sizeof...(Es)> weight{Es::weight...};
     };
+    using EdgeIdsOf = typename Edges::template exportTo<EdgeIds>;
 
-    template <Vertex CurNode, Vertex Target, TL Path>
-        requires(Elem_v<Path, CurNode>)
-    struct PathFinder<CurNode, Target, Path> : TypeList<>
+    // 顶点按在Edges中先起点后终点首次出现的顺序编号;在值层面排序去重,避免对顶点类型列表做Unique
+    struct NodeTable
     {
+        std::array<NodeId, 2 * edgesNum> ids{};
+        size_t size = 0;
     };
 
-    template <Vertex CurNode, Vertex Target, TL Path>
-    struct PathFinder
+    constexpr static NodeTable nodeTable = [] {
+        std::array<NodeId, 2 * edgesNum> ends{};
+        std::copy(EdgeIdsOf::from.begin(), EdgeIdsOf::from.end(), ends.begin());
+        std::copy(EdgeIdsOf::to.begin(), EdgeIdsOf::to.end(), ends.begin() + edgesNum);
+        // 按(id, 出现位置)排序,每组相同id的第一个即其首次出现
+        std::array<size_t, 2 * edgesNum> order{};
+        for (size_t i = 0; i < order.size(); ++i)
+        {
+            order[i] = i;
+        }
+        std::sort(order.begin(), order.end(), [&ends](size_t a, size_t b) {
+            return ends[a] < ends[b] || (ends[a] == ends[b] && a < b);
+        });
+        std::array<bool, 2 * edgesNum> first{};
+        for (size_t i = 0; i < order.size(); ++i)
+        {
+            first[order[i]] = i == 0 || ends[order[i - 1]] != ends[order[i]];
+        }
+        NodeTable result{};
+        for (size_t i = 0; i < ends.size(); ++i)
+        {
+            if (first[i])
+            {
+                result.ids[result.size++] = ends[i];
+            }
+        }
+        return result;
+    }();
+
+public:
+    constexpr static size_t nodesNum = nodeTable.size;
+
+    // 序号 -> 顶点id
+    constexpr static std::array<NodeId, nodesNum> nodeIds = [] {
+        std::array<NodeId, nodesNum> result{};
+        std::copy_n(nodeTable.ids.begin(), nodesNum, result.begin());
+        return result;
+    }();
+
+private:
+    using Ordinal = SmallestUint_t<nodesNum>;
+
+    // 参与寻址的64位键值:名字取其哈希,整型与枚举取其值
+    constexpr static uint64_t IdKey(NodeId id)
     {
-    private:
-        using EdgesFrom = Filter_t<Edges, EdgeTrait<CurNode>::template IsFrom>;
-        using NextNodes = Map_t<EdgesFrom, EdgeTrait<>::GetTo>;
+        if constexpr (namedIds)
+        {
+            return NameHash(id);
+        }
+        else if constexpr (std::is_enum_v<NodeId>)
+        {
+            return static_cast<uint64_t>(static_cast<std::underlying_type_t<NodeId>>(id));
+        }
+        else
+        {
+            return static_cast<uint64_t>(id);
+        }
+    }
+
+    constexpr static bool SameId(NodeId a, NodeId b)
+    {
+        if constexpr (namedIds)
+        {
+            return SameName(a, b);
+        }
+        else
+        {
+            return a == b;
+        }
+    }
+
+    // id -> 序号的运行期寻址:整型或枚举id的取值跨度不超过4V + 256时按与最小id的偏移直接寻址(单字节id总是如此),
+    // 否则经完美哈希定位候选序号后比较id
+    constexpr static NodeId minId = [] {
+        if constexpr (namedIds)
+        {
+            return NodeId{};
+        }
+        else
+        {
+            return *std::min_element(nodeIds.begin(), nodeIds.end());
+        }
+    }();
+
+    constexpr static uint64_t idSpan = [] {
+        uint64_t span = 0;
+        if constexpr (!namedIds)
+        {
+            // id取遍整个64位值域时偏移可达UINT64_MAX,加1会回绕为0,此时跨度按UINT64_MAX计
+            for (NodeId id : nodeIds)
+            {
+                uint64_t offset = IdKey(id) - IdKey(minId);
+                span = std::max(span, offset == UINT64_MAX ? offset : offset + 1);
+            }
+        }
+        return span;
+    }();
+
+    constexpr static bool directIndex = !namedIds && idSpan <= 4 * nodesNum + 256;
+
+    constexpr static std::array<Ordinal, directIndex ? idSpan : 0> directOrdinals = [] {
+        std::array<Ordinal, directIndex ? idSpan : 0> result{};
+        if constexpr (directIndex)
+        {
+            result.fill(static_cast<Ordinal>(nodesNum));
+            for (size_t ordinal = 0; ordinal < nodesNum; ++ordinal)
+            {
+                result[IdKey(nodeIds[ordinal]) - IdKey(minId)] = static_cast<Ordinal>(ordinal);
+            }
+        }
+        return result;
+    }();
+
+    constexpr static PerfectHash<directIndex ? 0 : nodesNum> idHash = [] {
+        std::array<uint64_t, directIndex ? 0 : nodesNum> keys{};
+        if constexpr (!directIndex)
+        {
+            for (size_t ordinal = 0; ordinal < nodesNum; ++ordinal)
+            {
+                keys[ordinal] = IdKey(nodeIds[ordinal]);
+            }
+        }
+        return PerfectHash<directIndex ? 0 : nodesNum>(keys);
+    }();
+    static_assert(idHash.Verify(), "node ids must be distinct and hashable");
+
+    // 哈希槽位 -> 序号
+    constexpr static std::array<Ordinal, directIndex ? 0 : nodesNum> slotOrdinals = [] {
+        std::array<Ordinal, directIndex ? 0 : nodesNum> result{};
+        if constexpr (!directIndex)
+        {
+            for (size_t ordinal = 0; ordinal < nodesNum; ++ordinal)
+            {
+                result[idHash.Find(IdKey(nodeIds[ordinal]))] = static_cast<Ordinal>(ordinal);
+            }
+        }
+        return result;
+    }();
 
-        template <Vertex AdjacentNode>
-        using GetPath = PathFinder<AdjacentNode, Target, typename Path::template append<CurNode>>;
+public:
+    // 顶点id -> 序号,不存在时返回nodesNum
+    constexpr static size_t OrdinalOf(NodeId id)
+    {
+        if constexpr (directIndex)
+        {
+            uint64_t offset = IdKey(id) - IdKey(minId);
+            return offset < idSpan ? directOrdinals[offset] : nodesNum;
+        }
+        else
+        {
+            size_t slot = idHash.Probe(IdKey(id));
+            if (slot >= nodesNum)
+            {
+                return nodesNum;
+            }
+            size_t ordinal = slotOrdinals[slot];
+            return SameId(nodeIds[ordinal], id) ? ordinal : nodesNum;
+        }
+    }
 
-        using AllPaths = Map_t<NextNodes, GetPath>;
-        template <TL MinPath, TL Path_>
-        using GetMinPath =
-            std::conditional_t<MinPath::size == 0 || (MinPath::size > Path_::size && Path_::size > 0), Path_, MinPath>;
+    // 越界的序号视为不存在,返回nodesNum
+    constexpr static size_t OrdinalOf(NodeOrdinal ordinal) { return ordinal.value < nodesNum ? ordinal.value : nodesNum; }
 
+    // 运行期接口的顶点参数:可由顶点id(或可无损转换为id的值,如名字字面量)或NodeOrdinal构造
+    // 整型id可由任意整型值构造,超出NodeId取值范围的值视为不存在,不会截断成另一个顶点
+    class NodeKey
+    {
     public:
-        using type = Fold_t<AllPaths, TypeList<>, GetMinPath>;
+        template <typename T>
+            requires(std::integral<T> && std::integral<NodeId>) ||
+                    (std::convertible_to<const T&, NodeId> && requires(const T& id) { NodeId{id}; })
+        constexpr NodeKey(const T& id) : ordinal_(Find(id))
+        {
+        }
+        constexpr NodeKey(NodeOrdinal ordinal) : ordinal_(OrdinalOf(ordinal)) {}
+
+        // 不存在时为nodesNum
+        constexpr size_t Ordinal() const { return ordinal_; }
+
+    private:
+        template <typename T>
+        constexpr static size_t Find(const T& id)
+        {
+            if constexpr (std::integral<T> && std::integral<NodeId>)
+            {
+                // 往返转换不变且符号一致时值在NodeId范围内
+                NodeId narrowed = static_cast<NodeId>(id);
+                if (static_cast<T>(narrowed) != id || (id < T{}) != (narrowed < NodeId{}))
+                {
+                    return nodesNum;
+                }
+                return OrdinalOf(narrowed);
+            }
+            else
+            {
+                return OrdinalOf(NodeId{id});
+            }
+        }
+
+        size_t ordinal_;
     };
 
-    template <Vertex From, Vertex Target>
-    using PathFinder_t = typename PathFinder<From, Target>::type;
+    // 查表:id转序号后按(from, to)直接取出跳数最少的路径,不可达时sz为0
+    // 仅起点有出边且终点有入边的点对有路径,与原实现一致
+    constexpr static PathRef<NodeId> GetShortestPath(NodeKey from, NodeKey to)
+    {
+        return Lookup<false>(from.Ordinal(), to.Ordinal());
+    }
+
+    // 可达性只读传递闭包,O(1),与GetShortestPath(from, to).sz > 0一致
+    constexpr static bool IsReachable(NodeKey from, NodeKey to)
+    {
+        return from.Ordinal() < nodesNum && closure[from.Ordinal()].Test(to.Ordinal());
+    }
+
+    using ReachSet = NodeSet<nodesNum>;
 
-    // 笛卡尔积获取所有点对
-    template <TL A, TL B, template <typename, typename> class Pair>
-    struct CrossProduct
+    // from可达的全部顶点,按序号索引;不存在的顶点返回空集
+    constexpr static const ReachSet& ReachableFrom(NodeKey from)
     {
-        template <TL OuterResult, typename ElemA>
-        struct OuterAppend
+        return from.Ordinal() < nodesNum ? closure[from.Ordinal()] : emptySet;
+    }
+
+    // 由顶点id或序号构造集合,用于与ReachableFrom的结果求交、计数等;不存在的顶点被忽略
+    constexpr static ReachSet MakeNodeSet(std::initializer_list<NodeKey> nodes)
+    {
+        ReachSet result{};
+        for (NodeKey node : nodes)
         {
-            template <TL InnerResult, typename ElemB>
-            using InnerAppend = typename InnerResult::template append<Pair<ElemA, ElemB>>;
-            using type = Fold_t<B, OuterResult, InnerAppend>;
-        };
+            if (node.Ordinal() < nodesNum)
+            {
+                result.Set(node.Ordinal());
+            }
+        }
+        return result;
+    }
+
+    // 边权之和最小的路径及其代价,不可达时sz为0
+    constexpr static WeightedPathRef<NodeId> GetCheapestPath(NodeKey from, NodeKey to)
+    {
+        return Lookup<true>(from.Ordinal(), to.Ordinal());
+    }
+
+    // 只读代价矩阵,不会引入路径存储
+    constexpr static std::optional<size_t> GetCost(NodeKey from, NodeKey to)
+    {
+        size_t f = from.Ordinal();
+        size_t t = to.Ordinal();
+        if (f == nodesNum || t == nodesNum || !IsPair(f, t) || Routes<true>::dist[t][f] == unreachable)
+        {
+            return std::nullopt;
+        }
+        return Routes<true>::dist[t][f];
+    }
 
+    // 路径存储有两种方式,按调用的接口择一实例化,未调用的一方不会进入二进制:
+    // GetShortestPath/GetCheapestPath为兼容方式,每条路径的顶点首尾相接常驻只读数据,规模O(V^2 * 路径长度);
+    // GetRoute/GetCheapestRoute只保留V行下一跳表,每行V个元素取最窄的整型,遍历时逐点展开
+    // 下一跳与代价均按终点逐行在各自的常量表达式中求出,单行开销O(V + E),按跳数时1000个顶点以默认编译选项可编译;
+    // 兼容方式的路径存储本身为O(V^2 * 路径长度),只适合数百个顶点以内的图
+    using RouteType = Route<NodeId, SmallestUint_t<nodesNum>>;
+
+    constexpr static RouteType GetRoute(NodeKey from, NodeKey to)
+    {
+        return LookupRoute<false>(from.Ordinal(), to.Ordinal());
+    }
+    constexpr static RouteType GetCheapestRoute(NodeKey from, NodeKey to)
+    {
+        return LookupRoute<true>(from.Ordinal(), to.Ordinal());
+    }
+
+    // 惰性枚举from到to的简单路径,按顶点数非降序产出,同长路径按边声明顺序;第一条即GetShortestPath
+    // 按路径长度逐层加深做深度优先搜索,以各点到to的跳数剪去不可能在本层到达的分支;
+    // 状态为定长数组,产出的PathRef指向枚举器内的缓冲区,在下一次递增前有效,不分配内存
+    // 提前结束循环即停止搜索,只为已取出的路径付出代价
+    class PathEnumerator
+    {
     public:
-        using type = Fold_t<A, TypeList<>, OuterAppend>;
+        class Iterator
+        {
+        public:
+            using value_type = PathRef<NodeId>;
+            using difference_type = std::ptrdiff_t;
+
+            constexpr Iterator() = default;
+            constexpr explicit Iterator(PathEnumerator* owner) : owner_(owner) {}
+
+            constexpr PathRef<NodeId> operator*() const { return owner_->Current(); }
+            constexpr Iterator& operator++()
+            {
+                owner_->Advance();
+                return *this;
+            }
+            constexpr void operator++(int) { ++*this; }
+            constexpr bool operator==(std::default_sentinel_t) const { return owner_->done_; }
+
+        private:
+            PathEnumerator* owner_ = nullptr;
+        };
+
+        // maxPaths为最多产出的路径数,maxNodes为路径最多含的顶点数
+        constexpr PathEnumerator(size_t from, size_t to, size_t maxPaths, size_t maxNodes)
+            : from_(from), to_(to), maxPaths_(maxPaths), maxNodes_(std::min(maxNodes, nodesNum))
+        {
+        }
+
+        // 首次调用时才开始搜索
+        constexpr Iterator begin()
+        {
+            if (!started_)
+            {
+                started_ = true;
+                Advance();
+            }
+            return Iterator(this);
+        }
+        constexpr std::default_sentinel_t end() const { return {}; }
+
+    private:
+        constexpr PathRef<NodeId> Current() const { return {ids_.data(), depth_}; }
+
+        constexpr static size_t HopsToTarget(size_t node, size_t to)
+        {
+            return Routes<false>::dist[to][node];
+        }
+
+        constexpr void Push(size_t node)
+        {
+            nodes_[depth_] = node;
+            ids_[depth_] = nodeIds[node];
+            cursors_[depth_] = adjacency.outStart[node];
+            onPath_.Set(node);
+            ++depth_;
+        }
+
+        constexpr void Pop()
+        {
+            --depth_;
+            onPath_.Reset(nodes_[depth_]);
+        }
+
+        // 找到下一条路径时ids_[0, depth_)即该路径,否则置done_
+        constexpr void Advance()
+        {
+            if (done_)
+            {
+                return;
+            }
+            if (yielded_ == maxPaths_ || from_ >= nodesNum || to_ >= nodesNum || !IsPair(from_, to_) ||
+                HopsToTarget(from_, to_) == unreachable)
+            {
+                done_ = true;
+                return;
+            }
+            if (from_ == to_)
+            {
+                // 简单路径不含环,只有单个顶点一条
+                if (yielded_ > 0 || maxNodes_ == 0)
+                {
+                    done_ = true;
+                    return;
+                }
+                depth_ = 0;
+                Push(from_);
+                ++yielded_;
+                return;
+            }
+            if (length_ == 0)
+            {
+                length_ = HopsToTarget(from_, to_) + 1;
+                depth_ = 0;
+            }
+            else
+            {
+                // 上一条路径的终点出栈,从其前一个顶点的下一条边继续
+                Pop();
+            }
+            while (length_ <= maxNodes_)
+            {
+                if (depth_ == 0)
+                {
+                    Push(from_);
+                }
+                while (depth_ > 0)
+                {
+                    size_t top = depth_ - 1;
+                    size_t node = nodes_[top];
+                    if (cursors_[top] == adjacency.outStart[node + 1])
+                    {
+                        Pop();
+                        continue;
+                    }
+                    size_t next = adjacency.outTo[cursors_[top]++];
+                    if (onPath_.Test(next))
+                    {
+                        continue;
+                    }
+                    if (next == to_)
+                    {
+                        if (depth_ + 1 == length_)
+                        {
+                            Push(next);
+                            ++yielded_;
+                            return;
+                        }
+                        continue;
+                    }
+                    size_t hops = HopsToTarget(next, to_);
+                    if (hops != unreachable && depth_ + 1 + hops <= length_)
+                    {
+                        Push(next);
+                    }
+                }
+                ++length_;
+            }
+            done_ = true;
+        }
+
+        size_t from_;
+        size_t to_;
+        size_t maxPaths_;
+        size_t maxNodes_;
+        size_t yielded_ = 0;
+        size_t length_ = 0; // 当前层的路径顶点数
+        size_t depth_ = 0;  // 栈中顶点数
+        bool started_ = false;
+        bool done_ = false;
+        std::array<size_t, nodesNum> nodes_{};
+        std::array<size_t, nodesNum> cursors_{};
+        std::array<NodeId, nodesNum> ids_{};
+        NodeSet<nodesNum> onPath_{};
     };
 
-    template <TL A, TL B, template <typename, typename> class Pair>
-    using CrossProduct_t = typename CrossProduct<A, B, Pair>::type;
+    // 最多maxPaths条、每条最多maxNodes个顶点的简单路径,按长度非降序
+    constexpr static PathEnumerator EnumeratePaths(NodeKey from, NodeKey to, size_t maxPaths = SIZE_MAX,
+                                                   size_t maxNodes = SIZE_MAX)
+    {
+        return PathEnumerator(from.Ordinal(), to.Ordinal(), maxPaths, maxNodes);
+    }
 
-    using AllPairs = CrossProduct_t<Unique_t<Map_t<Edges, EdgeTrait<>::GetFrom>>,
-                                    Unique_t<Map_t<Edges, EdgeTrait<>::GetTo>>, std::pair>;
-    template <typename NodePair>
-    using IsNonEmptyPath =
-        std::bool_constant<(PathFinder_t<typename NodePair::first_type, typename NodePair::second_type>::size > 0)>;
-    // 可达节点
-    using ReachableNodePairs = Filter_t<AllPairs, IsNonEmptyPath>;
-    template <Vertex Node, Vertex... Nodes>
-    class PathStorage
+    // 沿From到To跳数最少的路径依次调用各顶点的Handle(state)
+    // 路径在编译期已知,展开为一串直接调用,可整体内联,不经过id数组、switch或间接调用
+    template <Vertex From, Vertex To, typename State>
+    static void Run(State& state)
     {
-        using NodeType = std::decay_t<decltype(Node::id)>;
-        constexpr static NodeType pathStorage[]{Node::id, Nodes::id...};
+        constexpr size_t f = OrdinalOf(NodeIdOf<From>());
+        constexpr size_t t = OrdinalOf(NodeIdOf<To>());
+        static_assert(f < nodesNum && t < nodesNum, "node not in graph");
+        static_assert(Routes<false>::LengthOf(f, t) > 0, "no path between nodes");
+        RunOrdinals<f, t>(state);
+    }
 
-    public:
-        constexpr static PathRef<NodeType> path{.path = pathStorage, .sz = sizeof...(Nodes) + 1};
+    // 起止点在运行期给出时,经按终点分行的跳转表进入预先展开的路径,无路径时返回false
+    // 跳转表只在调用时按State实例化,此时图中所有路径上的顶点都须提供Handle
+    template <typename State>
+    static bool Run(NodeKey from, NodeKey to, State& state)
+    {
+        size_t f = from.Ordinal();
+        size_t t = to.Ordinal();
+        if (f == nodesNum || t == nodesNum || runTable<State>[t][f] == nullptr)
+        {
+            return false;
+        }
+        runTable<State>[t][f](state);
+        return true;
+    }
+
+    // 邻接数组,RuntimeGraph与TaskGraph由此取得与Graph一致的顶点序号与边顺序
+    constexpr static Adjacency<nodesNum, edgesNum> adjacency = [] {
+        Adjacency<nodesNum, edgesNum> result{};
+        std::array<size_t, edgesNum>& from = result.from;
+        std::array<size_t, edgesNum>& to = result.to;
+        for (size_t e = 0; e < edgesNum; ++e)
+        {
+            from[e] = OrdinalOf(EdgeIdsOf::from[e]);
+            to[e] = OrdinalOf(EdgeIdsOf::to[e]);
+            ++result.outStart[from[e] + 1];
+            ++result.inStart[to[e] + 1];
+        }
+        for (size_t n = 0; n < nodesNum; ++n)
+        {
+            result.outStart[n + 1] += result.outStart[n];
+            result.inStart[n + 1] += result.inStart[n];
+        }
+        std::array<size_t, nodesNum> outFill{};
+        std::array<size_t, nodesNum> inFill{};
+        for (size_t e = 0; e < edgesNum; ++e)
+        {
+            size_t out = result.outStart[from[e]] + outFill[from[e]]++;
+            result.outTo[out] = to[e];
+            result.outWeight[out] = EdgeIdsOf::weight[e];
+            size_t in = result.inStart[to[e]] + inFill[to[e]]++;
+            result.inFrom[in] = from[e];
+            result.inWeight[in] = EdgeIdsOf::weight[e];
+        }
+        return result;
+    }();
+
+private:
+    // 没有出边的起点或没有入边的终点不构成点对
+    constexpr static bool IsPair(size_t from, size_t to)
+    {
+        return adjacency.outStart[from + 1] > adjacency.outStart[from] &&
+               adjacency.inStart[to + 1] > adjacency.inStart[to];
+    }
+
+    // V×V传递闭包,按字并行的Warshall:若i可达k,则把k的行并入i的行,每次合并64个顶点
+    // 行x还包含x自身当且仅当x既有出边又有入边,与路径查询对(x, x)的约定一致
+    constexpr static std::array<NodeSet<nodesNum>, nodesNum> closure = [] {
+        std::array<NodeSet<nodesNum>, nodesNum> result{};
+        for (size_t from = 0; from < nodesNum; ++from)
+        {
+            for (size_t e = adjacency.outStart[from]; e < adjacency.outStart[from + 1]; ++e)
+            {
+                result[from].Set(adjacency.outTo[e]);
+            }
+        }
+        for (size_t k = 0; k < nodesNum; ++k)
+        {
+            for (size_t i = 0; i < nodesNum; ++i)
+            {
+                if (result[i].Test(k))
+                {
+                    result[i] |= result[k];
+                }
+            }
+        }
+        for (size_t x = 0; x < nodesNum; ++x)
+        {
+            if (IsPair(x, x))
+            {
+                result[x].Set(x);
+            }
+        }
+        return result;
+    }();
+
+    constexpr static NodeSet<nodesNum> emptySet{};
+
+    // 代价表与下一跳表,各行由RouteRows按邻接数组求值;仅在用到时实例化
+    template <bool Weighted>
+    using Routes = RouteRows<adjacency, Weighted>;
+
+    // 按(from, to)存放整条路径的表;pathNodes的长度须先对全部点对求路径长度,
+    // 与Routes分开,只按下一跳查询时不实例化
+    template <bool Weighted>
+    struct PathTables
+    {
+        using Ref = std::conditional_t<Weighted, WeightedPathRef<NodeId>, PathRef<NodeId>>;
+        using Rows = Routes<Weighted>;
+
+        // 所有路径首尾相接存放所需的顶点数
+        constexpr static size_t pathNodesNum = [] {
+            size_t total = 0;
+            for (size_t from = 0; from < nodesNum; ++from)
+            {
+                for (size_t to = 0; to < nodesNum; ++to)
+                {
+                    total += Rows::LengthOf(from, to);
+                }
+            }
+            return total;
+        }();
+
+        // 全部路径的顶点id首尾相接,按(from, to)序依次存放,路径上各点沿下一跳表展开
+        constexpr static std::array<NodeId, pathNodesNum> pathNodes = [] {
+            std::array<NodeId, pathNodesNum> result{};
+            NodeId* nodes = result.data();
+            const NodeId* ids = nodeIds.data();
+            for (size_t from = 0; from < nodesNum; ++from)
+            {
+                for (size_t to = 0; to < nodesNum; ++to)
+                {
+                    if (Rows::LengthOf(from, to) == 0)
+                    {
+                        continue;
+                    }
+                    const typename Rows::Hop* hop = Rows::next[to];
+                    size_t cur = from;
+                    *nodes++ = ids[cur];
+                    while (cur != to)
+                    {
+                        cur = hop[cur];
+                        *nodes++ = ids[cur];
+                    }
+                }
+            }
+            return result;
+        }();
+
+        // (from, to)序号 -> 路径
+        constexpr static std::array<Ref, nodesNum * nodesNum> table = [] {
+            std::array<Ref, nodesNum * nodesNum> result{};
+            size_t pos = 0;
+            for (size_t from = 0; from < nodesNum; ++from)
+            {
+                for (size_t to = 0; to < nodesNum; ++to)
+                {
+                    size_t length = Rows::LengthOf(from, to);
+                    if (length == 0)
+                    {
+                        continue;
+                    }
+                    Ref& ref = result[from * nodesNum + to];
+                    ref.path = pathNodes.data() + pos;
+                    ref.sz = length;
+                    if constexpr (Weighted)
+                    {
+                        ref.cost = Rows::dist[to][from];
+                    }
+                    pos += length;
+                }
+            }
+            return result;
+        }();
     };
 
-    template <typename NodePair>
-    using PathData = Return<
-        std::pair<NodePair, typename PathFinder_t<typename NodePair::first_type,
-                                                  typename NodePair::second_type>::template exportTo<PathStorage>>>;
-    using AllSavedPaths = Map_t<ReachableNodePairs, PathData>;
+    template <bool Weighted>
+    constexpr static RouteType LookupRoute(size_t f, size_t t)
+    {
+        if (f == nodesNum || t == nodesNum || Routes<Weighted>::next[t][f] == nodesNum)
+        {
+            return {};
+        }
+        return {Routes<Weighted>::next[t], nodeIds.data(), nodesNum, f, t};
+    }
 
-    template <typename NodeType, typename From, typename Target, typename PathStorage_>
-    constexpr static bool matchPath(NodeType from, NodeType to, PathRef<NodeType>& result,
-                                    std::pair<std::pair<From, Target>, PathStorage_>)
+    template <bool Weighted>
+    constexpr static typename PathTables<Weighted>::Ref Lookup(size_t f, size_t t)
     {
-        if (From::id == from && Target::id == to)
+        if (f == nodesNum || t == nodesNum)
         {
-            result = PathStorage_::path;
-            return true;
+            return {};
         }
-        return false;
+        return PathTables<Weighted>::table[f * nodesNum + t];
     }
 
-    template <typename NodeType, typename... PathPairs>
-    constexpr static void matchPath(NodeType from, NodeType to, PathRef<NodeType>& result, TypeList<PathPairs...>)
+    // 序号 -> 顶点类型,取该顶点首次出现的边
+    constexpr static std::pair<size_t, bool> FirstEdgeOf(size_t ordinal)
     {
-        (matchPath(from, to, result, PathPairs{}) || ...);
+        for (size_t e = 0; e < edgesNum; ++e)
+        {
+            if (OrdinalOf(EdgeIdsOf::from[e]) == ordinal)
+            {
+                return {e, true};
+            }
+        }
+        for (size_t e = 0; e < edgesNum; ++e)
+        {
+            if (OrdinalOf(EdgeIdsOf::to[e]) == ordinal)
+            {
+                return {e, false};
+            }
+        }
+        return {edgesNum, false};
     }
+
+    template <size_t Ordinal>
+    using NodeAt = std::conditional_t<FirstEdgeOf(Ordinal).second, typename At_t<Edges, FirstEdgeOf(Ordinal).first>::From,
+                                      typename At_t<Edges, FirstEdgeOf(Ordinal).first>::To>;
+
+    // From到To路径上各顶点的序号
+    template <size_t From, size_t To>
+    constexpr static auto pathOrdinals = [] {
+        std::array<size_t, Routes<false>::LengthOf(From, To)> result{};
+        size_t cur = From;
+        for (size_t& ordinal : result)
+        {
+            ordinal = cur;
+            cur = Routes<false>::next[To][cur];
+        }
+        return result;
+    }();
+
+    template <size_t From, size_t To, typename State>
+    static void RunOrdinals(State& state)
+    {
+        [&state]<size_t... Is>(std::index_sequence<Is...>) {
+            static_assert((NodeHandler<NodeAt<pathOrdinals<From, To>[Is]>, State> && ...),
+                          "every node on the path must provide Handle(state)");
+            (NodeAt<pathOrdinals<From, To>[Is]>::Handle(state), ...);
+        }(std::make_index_sequence<pathOrdinals<From, To>.size()>{});
+    }
+
+    template <typename State>
+    using RunFn = void (*)(State&);
+
+    // 终点为To的一行跳转表,各行分别求值
+    template <typename State, size_t To>
+    constexpr static std::array<RunFn<State>, nodesNum> runTo = []<size_t... Froms>(std::index_sequence<Froms...>) {
+        return std::array<RunFn<State>, nodesNum>{[] {
+            if constexpr (Routes<false>::LengthOf(Froms, To) > 0)
+            {
+                return &RunOrdinals<Froms, To, State>;
+            }
+            else
+            {
+                return RunFn<State>{nullptr};
+            }
+        }()...};
+    }(std::make_index_sequence<nodesNum>{});
+
+    // runTable<State>[to][from]
+    template <typename State>
+    constexpr static std::array<const RunFn<State>*, nodesNum> runTable =
+        []<size_t... Tos>(std::index_sequence<Tos...>) {
+            return std::array<const RunFn<State>*, nodesNum>{runTo<State, Tos>.data()...};
+        }(std::make_index_sequence<nodesNum>{});
+
+public:
+    // 两种存储方式各静态表的sizeof之和,为编译期估算;PathRef表含指针,PIE下另有.data.rel.ro与重定位,
+    // 实测的段大小由compile_cost目标写入route_storage.csv
+    template <bool Weighted = false>
+    constexpr static size_t pathRefBytes = sizeof(PathTables<Weighted>::table) + sizeof(PathTables<Weighted>::pathNodes);
+    template <bool Weighted = false>
+    constexpr static size_t routeBytes =
+        nodesNum * sizeof(std::array<typename Routes<Weighted>::Hop, nodesNum>) + sizeof(Routes<Weighted>::next);
 };
 
 #endif // !GRAPH_H
\ No newline at end of file
@@ -0,0 +1,190 @@
+/*	Copyright(C)
+    Author: 479764650@qq.com
+    Description: 编译期最小完美哈希,将N个稀疏键映射到稠密序号[0, N)
+    History: 2026/10/17
+*/
+
+#ifndef PERFECT_HASH_H
+#define PERFECT_HASH_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+// 两级哈希:键先乘移位落入桶,再与桶的导频值混合后乘移位落入槽位,槽位即序号
+// 构建时按桶从大到小为每个桶搜索无冲突的导频值;键恰为0..N-1时退化为直接映射
+// 查找为两次乘移位加一次键比较,不使用堆内存
+template <size_t N>
+class PerfectHash
+{
+private:
+    constexpr static size_t bucketsNum = N / 2 + 1;
+    constexpr static uint32_t maxPilot = 1u << 20;
+
+    std::array<uint64_t, N> keys_{};          // 槽位 -> 键,查找时确认命中
+    std::array<uint32_t, bucketsNum> pilots_{};
+    bool dense_ = true;
+    bool valid_ = true;
+
+    // 将32位哈希值均匀缩放到[0, n)
+    constexpr static size_t Reduce(uint64_t hash, size_t n) { return (hash >> 32) * n >> 32; }
+
+    constexpr static size_t BucketOf(uint64_t key) { return Reduce(key * 0x9E3779B97F4A7C15ull, bucketsNum); }
+
+    constexpr static size_t SlotOf(uint64_t key, uint32_t pilot)
+    {
+        uint64_t x = (key ^ (pilot * 0xC2B2AE3D27D4EB4Full)) * 0xFF51AFD7ED558CCDull;
+        return Reduce(x ^ (x >> 29), N);
+    }
+
+    constexpr void Build(std::array<uint64_t, N> keys)
+    {
+        // 先排序,保证同一组键无论声明顺序如何都得到相同的映射
+        for (size_t i = 1; i < N; ++i)
+        {
+            for (size_t j = i; j > 0 && keys[j - 1] > keys[j]; --j)
+            {
+                std::swap(keys[j - 1], keys[j]);
+            }
+        }
+        for (size_t i = 0; i < N; ++i)
+        {
+            if (i > 0 && keys[i] == keys[i - 1])
+            {
+                valid_ = false; // 重复的键
+                return;
+            }
+            dense_ = dense_ && keys[i] == i;
+        }
+        if (dense_)
+        {
+            keys_ = keys;
+            return;
+        }
+
+        // 按桶归类:members中[starts[b], starts[b + 1])为桶b的键
+        std::array<size_t, bucketsNum + 1> starts{};
+        for (uint64_t key : keys)
+        {
+            ++starts[BucketOf(key) + 1];
+        }
+        for (size_t bucket = 0; bucket < bucketsNum; ++bucket)
+        {
+            starts[bucket + 1] += starts[bucket];
+        }
+        std::array<uint64_t, N> members{};
+        std::array<size_t, bucketsNum> filled{};
+        for (uint64_t key : keys)
+        {
+            size_t bucket = BucketOf(key);
+            members[starts[bucket] + filled[bucket]++] = key;
+        }
+
+        std::array<bool, N> used{};
+        for (size_t size = N; size > 0; --size)
+        {
+            for (size_t bucket = 0; bucket < bucketsNum; ++bucket)
+            {
+                if (starts[bucket + 1] - starts[bucket] == size &&
+                    !PlaceBucket(members.data() + starts[bucket], size, bucket, used))
+                {
+                    valid_ = false;
+                    return;
+                }
+            }
+        }
+    }
+
+    constexpr bool PlaceBucket(const uint64_t* keys, size_t size, size_t bucket, std::array<bool, N>& used)
+    {
+        for (uint32_t pilot = 0; pilot < maxPilot; ++pilot)
+        {
+            std::array<size_t, N> slots{};
+            bool ok = true;
+            for (size_t i = 0; i < size && ok; ++i)
+            {
+                slots[i] = SlotOf(keys[i], pilot);
+                ok = !used[slots[i]];
+                for (size_t j = 0; j < i && ok; ++j)
+                {
+                    ok = slots[j] != slots[i];
+                }
+            }
+            if (!ok)
+            {
+                continue;
+            }
+            for (size_t i = 0; i < size; ++i)
+            {
+                used[slots[i]] = true;
+                keys_[slots[i]] = keys[i];
+            }
+            pilots_[bucket] = pilot;
+            return true;
+        }
+        return false;
+    }
+
+public:
+    constexpr explicit PerfectHash(const std::array<uint64_t, N>& keys) { Build(keys); }
+
+    // 键 -> 序号,不存在时返回N
+    constexpr size_t Find(uint64_t key) const
+    {
+        if (dense_)
+        {
+            return key < N ? key : N;
+        }
+        size_t slot = SlotOf(key, pilots_[BucketOf(key)]);
+        return keys_[slot] == key ? slot : N;
+    }
+
+    // 键 -> 候选槽位,不比较键;调用方需自行确认命中(如名字键比较名字本身)
+    constexpr size_t Probe(uint64_t key) const
+    {
+        if (dense_)
+        {
+            return key < N ? key : N;
+        }
+        return SlotOf(key, pilots_[BucketOf(key)]);
+    }
+
+    // 序号 -> 键
+    constexpr uint64_t KeyAt(size_t slot) const { return keys_[slot]; }
+
+    constexpr bool IsDense() const { return dense_; }
+
+    // 编译期校验:键互不相同,且每个键都映射回自己的槽位
+    constexpr bool Verify() const
+    {
+        if (!valid_)
+        {
+            return false;
+        }
+        std::array<bool, N> seen{};
+        for (size_t slot = 0; slot < N; ++slot)
+        {
+            if (Find(keys_[slot]) != slot || seen[slot])
+            {
+                return false;
+            }
+            seen[slot] = true;
+        }
+        return true;
+    }
+};
+
+template <>
+class PerfectHash<0>
+{
+public:
+    constexpr explicit PerfectHash(const std::array<uint64_t, 0>&) {}
+    constexpr size_t Find(uint64_t) const { return 0; }
+    constexpr size_t Probe(uint64_t) const { return 0; }
+    constexpr uint64_t KeyAt(size_t) const { return 0; }
+    constexpr bool IsDense() const { return true; }
+    constexpr bool Verify() const { return true; }
+};
+
+#endif // !PERFECT_HASH_H
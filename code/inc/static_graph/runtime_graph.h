@@ -0,0 +1,463 @@
+/*	Copyright(C)
+    Author: 479764650@qq.com
+    Description: 运行期CSR图,以静态图的边在编译期生成初始邻接,运行期可继续加边,提供BFS查询
+    History: 2026/10/17
+*/
+
+#ifndef RUNTIME_GRAPH_H
+#define RUNTIME_GRAPH_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <barrier>
+#include <cstdint>
+#include <deque>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+#include "graph.h"
+
+// 运行期图
+// 顶点以加入顺序编号,出边与入边各存一份CSR;加边先进入待合并列表,下次查询前(或显式Commit)以计数排序一次性重建,
+// 同一顶点的边保持加入顺序,由静态图构造时与其Edges的声明顺序一致,因此最短路径与Graph::GetShortestPath选出同一条
+// 查询复用对象内的缓冲区,不在每次查询时分配内存;同一对象不可被多个线程同时查询
+template <typename NodeType>
+class RuntimeGraph
+{
+public:
+    constexpr static uint32_t unreachable = UINT32_MAX;
+
+    RuntimeGraph() = default;
+
+    // 以静态图的拓扑为初始内容,CSR直接拷贝编译期生成的数组
+    template <typename G>
+        requires std::is_same_v<typename G::NodeId, NodeType>
+    static RuntimeGraph FromGraph()
+    {
+        constexpr auto& adjacency = G::adjacency;
+        RuntimeGraph result;
+        for (NodeType id : G::nodeIds)
+        {
+            result.AddNode(id);
+        }
+        result.from_.assign(adjacency.from.begin(), adjacency.from.end());
+        result.to_.assign(adjacency.to.begin(), adjacency.to.end());
+        result.outStart_.assign(adjacency.outStart.begin(), adjacency.outStart.end());
+        result.outTo_.assign(adjacency.outTo.begin(), adjacency.outTo.end());
+        result.BuildIn();
+        result.committed_ = result.from_.size();
+        return result;
+    }
+
+    // 返回顶点序号,已存在时不重复加入;string_view的名字会被拷贝,调用方的缓冲区无需长期有效
+    size_t AddNode(NodeType id) { return nodes_.Add(id); }
+
+    // 顶点不存在时自动加入
+    void AddEdge(NodeType from, NodeType to)
+    {
+        size_t f = AddNode(from);
+        size_t t = AddNode(to);
+        from_.push_back(static_cast<uint32_t>(f));
+        to_.push_back(static_cast<uint32_t>(t));
+    }
+
+    // 将待合并的边并入CSR,O(V + E)
+    void Commit()
+    {
+        if (committed_ == from_.size() && outStart_.size() == nodes_.Size() + 1)
+        {
+            return;
+        }
+        BuildCsr(from_, to_, outStart_, outTo_);
+        BuildIn();
+        committed_ = from_.size();
+    }
+
+    size_t NodesNum() const { return nodes_.Size(); }
+    size_t EdgesNum() const { return from_.size(); }
+
+    // 顶点id -> 序号,不存在时返回NodesNum()
+    size_t OrdinalOf(NodeType id) const { return nodes_.Find(id); }
+
+    NodeType IdOf(size_t ordinal) const { return nodes_[ordinal]; }
+
+    // 已合并的后继序号
+    std::span<const uint32_t> Successors(size_t ordinal) const
+    {
+        return {outTo_.data() + outStart_[ordinal], outTo_.data() + outStart_[ordinal + 1]};
+    }
+
+    // 跳数最少的路径,语义与Graph::GetShortestPath一致:仅起点有出边且终点有入边的点对有路径,不可达时sz为0
+    // 返回的路径指向对象内缓冲区,下次查询前有效
+    PathRef<NodeType> GetShortestPath(NodeType from, NodeType to)
+    {
+        Commit();
+        size_t f = OrdinalOf(from);
+        size_t t = OrdinalOf(to);
+        if (f == nodes_.Size() || t == nodes_.Size() || !IsPair(f, t) || !ReverseSearch(f, t))
+        {
+            return {nullptr, 0};
+        }
+        // 从起点按出边顺序贪心选取距离恰好减一的后继
+        path_.clear();
+        path_.push_back(nodes_[f]);
+        for (size_t cur = f; cur != t;)
+        {
+            uint32_t want = DistToTarget(cur) - 1;
+            for (uint32_t next : Successors(cur))
+            {
+                if (DistToTarget(next) == want)
+                {
+                    cur = next;
+                    break;
+                }
+            }
+            path_.push_back(nodes_[cur]);
+        }
+        return {path_.data(), path_.size()};
+    }
+
+    bool IsReachable(NodeType from, NodeType to) { return GetShortestPath(from, to).sz > 0; }
+
+    // 单源BFS,返回按序号索引的跳数,不可达为unreachable
+    const std::vector<uint32_t>& Bfs(NodeType source) { return Bfs(std::span<const NodeType>(&source, 1)); }
+
+    // 多源BFS:到最近一个源点的跳数,不存在的源点被忽略
+    const std::vector<uint32_t>& Bfs(std::span<const NodeType> sources)
+    {
+        Commit();
+        InitSources(sources);
+        // 每个顶点只入队一次,frontier_同时作为队列
+        const uint32_t* start = outStart_.data();
+        const uint32_t* adj = outTo_.data();
+        uint32_t* dist = dist_.data();
+        for (size_t head = 0; head < frontier_.size(); ++head)
+        {
+            uint32_t u = frontier_[head];
+            uint32_t level = dist[u] + 1;
+            for (uint32_t e = start[u]; e < start[u + 1]; ++e)
+            {
+                uint32_t v = adj[e];
+                if (dist[v] == unreachable)
+                {
+                    dist[v] = level;
+                    frontier_.push_back(v);
+                }
+            }
+        }
+        return dist_;
+    }
+
+    // 按层同步的并行BFS:每层的frontier按块分给各线程认领,以CAS标记首次访问,
+    // 各线程把新顶点写入私有缓冲,层末按前缀和拼接为下一层frontier;结果与Bfs一致
+    // 每次调用新建threadsNum - 1个线程与一个barrier,有意不常驻线程,保持图对象可拷贝的值语义;
+    // 线程启动为微秒级的固定开销,只在frontier足够宽、每层工作量远大于此时才比Bfs快
+    const std::vector<uint32_t>& ParallelBfs(std::span<const NodeType> sources, size_t threadsNum)
+    {
+        Commit();
+        InitSources(sources);
+        threadsNum = std::max<size_t>(threadsNum, 1);
+        size_t frontierSize = frontier_.size();
+        // 两块frontier缓冲区交替使用,均预留全部顶点,层内不再分配
+        frontier_.resize(nodes_.Size());
+        next_.resize(nodes_.Size());
+        locals_.resize(threadsNum);
+        offsets_.assign(threadsNum + 1, 0);
+        for (std::vector<uint32_t>& local : locals_)
+        {
+            local.reserve(nodes_.Size());
+            local.clear();
+        }
+
+        std::atomic<size_t> claim{0};
+        uint32_t level = 0;
+        // 两个阶段之间由barrier的完成函数串行收尾:先算各线程的写入偏移,再交换frontier进入下一层
+        bool gathering = true;
+        auto onPhaseEnd = [&]() noexcept {
+            if (gathering)
+            {
+                for (size_t i = 0; i < threadsNum; ++i)
+                {
+                    offsets_[i + 1] = offsets_[i] + locals_[i].size();
+                }
+            }
+            else
+            {
+                frontier_.swap(next_);
+                frontierSize = offsets_[threadsNum];
+                claim.store(0, std::memory_order_relaxed);
+                ++level;
+            }
+            gathering = !gathering;
+        };
+        std::barrier sync(static_cast<std::ptrdiff_t>(threadsNum), onPhaseEnd);
+
+        auto worker = [&](size_t self) {
+            std::vector<uint32_t>& local = locals_[self];
+            while (frontierSize > 0)
+            {
+                for (size_t begin = claim.fetch_add(chunk, std::memory_order_relaxed); begin < frontierSize;
+                     begin = claim.fetch_add(chunk, std::memory_order_relaxed))
+                {
+                    size_t end = std::min(begin + chunk, frontierSize);
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        uint32_t u = frontier_[i];
+                        for (uint32_t e = outStart_[u]; e < outStart_[u + 1]; ++e)
+                        {
+                            std::atomic_ref<uint32_t> dist(dist_[outTo_[e]]);
+                            uint32_t expected = unreachable;
+                            if (dist.load(std::memory_order_relaxed) == unreachable &&
+                                dist.compare_exchange_strong(expected, level + 1, std::memory_order_relaxed))
+                            {
+                                local.push_back(outTo_[e]);
+                            }
+                        }
+                    }
+                }
+                sync.arrive_and_wait();
+                std::copy(local.begin(), local.end(), next_.begin() + offsets_[self]);
+                local.clear();
+                sync.arrive_and_wait();
+            }
+        };
+
+        std::vector<std::jthread> helpers;
+        helpers.reserve(threadsNum - 1);
+        try
+        {
+            for (size_t i = 1; i < threadsNum; ++i)
+            {
+                helpers.emplace_back(worker, i);
+            }
+        }
+        catch (...)
+        {
+            // 已启动的线程在barrier上等待全部参与者,把未启动的线程与本线程退出同步,
+            // 它们才能跑完BFS,jthread析构时的join不会永久阻塞
+            for (size_t i = helpers.size(); i < threadsNum; ++i)
+            {
+                sync.arrive_and_drop();
+            }
+            throw;
+        }
+        worker(0);
+        return dist_;
+    }
+
+private:
+    // 并行BFS每次认领的frontier顶点数
+    constexpr static size_t chunk = 64;
+
+    // 顶点id与序号的双向映射:单字节id用直接寻址表,其他类型用哈希表;
+    // string_view的id先拷贝进表内持有的存储,ids与哈希表的键都指向这份拷贝,拷贝整表时重新指向新副本
+    class NodeTable
+    {
+    public:
+        NodeTable() = default;
+        NodeTable(const NodeTable& other) : names_(other.names_), ids_(other.ids_), ordinals_(other.ordinals_)
+        {
+            Rebind();
+        }
+        // deque移动时元素不搬家,视图依然有效
+        NodeTable(NodeTable&&) = default;
+        NodeTable& operator=(const NodeTable& other) { return *this = NodeTable(other); }
+        NodeTable& operator=(NodeTable&&) = default;
+
+        size_t Size() const { return ids_.size(); }
+        NodeType operator[](size_t ordinal) const { return ids_[ordinal]; }
+
+        size_t Find(NodeType id) const
+        {
+            if constexpr (smallId)
+            {
+                uint32_t ordinal = ordinals_[Slot(id)];
+                return ordinal == unreachable ? ids_.size() : ordinal;
+            }
+            else
+            {
+                auto it = ordinals_.find(id);
+                return it == ordinals_.end() ? ids_.size() : it->second;
+            }
+        }
+
+        size_t Add(NodeType id)
+        {
+            size_t ordinal = Find(id);
+            if (ordinal == ids_.size())
+            {
+                if constexpr (ownsNames)
+                {
+                    id = names_.emplace_back(id);
+                }
+                if constexpr (smallId)
+                {
+                    ordinals_[Slot(id)] = static_cast<uint32_t>(ordinal);
+                }
+                else
+                {
+                    ordinals_.emplace(id, static_cast<uint32_t>(ordinal));
+                }
+                ids_.push_back(id);
+            }
+            return ordinal;
+        }
+
+    private:
+        constexpr static bool smallId = sizeof(NodeType) == 1;
+        constexpr static bool ownsNames = std::is_same_v<NodeType, std::string_view>;
+
+        static size_t Slot(NodeType id) { return static_cast<unsigned char>(id); }
+
+        static std::array<uint32_t, 256> EmptyOrdinals()
+        {
+            std::array<uint32_t, 256> result{};
+            result.fill(unreachable);
+            return result;
+        }
+
+        void Rebind()
+        {
+            if constexpr (ownsNames)
+            {
+                ordinals_.clear();
+                for (size_t i = 0; i < ids_.size(); ++i)
+                {
+                    ids_[i] = names_[i];
+                    ordinals_.emplace(ids_[i], static_cast<uint32_t>(i));
+                }
+            }
+        }
+
+        [[no_unique_address]] std::conditional_t<ownsNames, std::deque<std::string>, std::monostate> names_;
+        std::vector<NodeType> ids_;
+        std::conditional_t<smallId, std::array<uint32_t, 256>, std::unordered_map<NodeType, uint32_t>> ordinals_ =
+            [] {
+                if constexpr (smallId)
+                {
+                    return EmptyOrdinals();
+                }
+                else
+                {
+                    return std::unordered_map<NodeType, uint32_t>{};
+                }
+            }();
+    };
+
+    // 按边的加入顺序做稳定的计数排序,start[v]到start[v + 1]为v的边
+    void BuildCsr(const std::vector<uint32_t>& keys, const std::vector<uint32_t>& values, std::vector<uint32_t>& start,
+                  std::vector<uint32_t>& adj) const
+    {
+        start.assign(nodes_.Size() + 1, 0);
+        for (uint32_t key : keys)
+        {
+            ++start[key + 1];
+        }
+        for (size_t v = 0; v < nodes_.Size(); ++v)
+        {
+            start[v + 1] += start[v];
+        }
+        adj.resize(keys.size());
+        std::vector<uint32_t> cursor(start.begin(), start.end() - 1);
+        for (size_t e = 0; e < keys.size(); ++e)
+        {
+            adj[cursor[keys[e]]++] = values[e];
+        }
+    }
+
+    void BuildIn() { BuildCsr(to_, from_, inStart_, inFrom_); }
+
+    bool IsPair(size_t from, size_t to) const
+    {
+        return outStart_[from] != outStart_[from + 1] && inStart_[to] != inStart_[to + 1];
+    }
+
+    void InitSources(std::span<const NodeType> sources)
+    {
+        dist_.assign(nodes_.Size(), unreachable);
+        frontier_.clear();
+        frontier_.reserve(nodes_.Size());
+        for (NodeType id : sources)
+        {
+            size_t ordinal = OrdinalOf(id);
+            if (ordinal != nodes_.Size() && dist_[ordinal] == unreachable)
+            {
+                dist_[ordinal] = 0;
+                frontier_.push_back(static_cast<uint32_t>(ordinal));
+            }
+        }
+    }
+
+    // 以本次查询的标记区分有效距离,免去每次查询清零
+    uint32_t DistToTarget(size_t ordinal) const
+    {
+        return stamps_[ordinal] == stamp_ ? targetDist_[ordinal] : unreachable;
+    }
+
+    // 在反向图上从终点BFS,到达起点即停止;此时距离小于起点的顶点均已确定,足以回溯路径
+    bool ReverseSearch(size_t from, size_t to)
+    {
+        if (stamps_.size() != nodes_.Size())
+        {
+            stamps_.assign(nodes_.Size(), 0);
+            targetDist_.resize(nodes_.Size());
+            stamp_ = 0;
+        }
+        if (++stamp_ == 0)
+        {
+            std::fill(stamps_.begin(), stamps_.end(), 0);
+            stamp_ = 1;
+        }
+        queue_.clear();
+        queue_.push_back(static_cast<uint32_t>(to));
+        stamps_[to] = stamp_;
+        targetDist_[to] = 0;
+        for (size_t head = 0; head < queue_.size() && stamps_[from] != stamp_; ++head)
+        {
+            uint32_t v = queue_[head];
+            for (uint32_t e = inStart_[v]; e < inStart_[v + 1]; ++e)
+            {
+                uint32_t u = inFrom_[e];
+                if (stamps_[u] != stamp_)
+                {
+                    stamps_[u] = stamp_;
+                    targetDist_[u] = targetDist_[v] + 1;
+                    queue_.push_back(u);
+                }
+            }
+        }
+        return stamps_[from] == stamp_;
+    }
+
+    NodeTable nodes_;
+
+    // 全部边按加入顺序的起止序号,前committed_条已并入CSR
+    std::vector<uint32_t> from_;
+    std::vector<uint32_t> to_;
+    size_t committed_ = 0;
+
+    std::vector<uint32_t> outStart_{0};
+    std::vector<uint32_t> outTo_;
+    std::vector<uint32_t> inStart_{0};
+    std::vector<uint32_t> inFrom_;
+
+    // 查询缓冲区
+    std::vector<uint32_t> dist_;
+    std::vector<uint32_t> frontier_;
+    std::vector<uint32_t> next_;
+    std::vector<std::vector<uint32_t>> locals_;
+    std::vector<size_t> offsets_;
+    std::vector<uint32_t> queue_;
+    std::vector<uint32_t> targetDist_;
+    std::vector<uint32_t> stamps_;
+    uint32_t stamp_ = 0;
+    std::vector<NodeType> path_;
+};
+
+#endif // !RUNTIME_GRAPH_H
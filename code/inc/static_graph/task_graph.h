@@ -0,0 +1,412 @@
+/*	Copyright(C)
+    Author: 479764650@qq.com
+    Description: 静态任务图,以Graph描述任务依赖,编译期拓扑排序,在工作窃取线程池上并行执行
+    History: 2026/10/17
+*/
+
+#ifndef TASK_GRAPH_H
+#define TASK_GRAPH_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "graph.h"
+
+// 工作窃取线程池,执行以CSR描述的DAG
+// 每个工作线程持有一个Chase-Lev双端队列:自己从底部压入弹出,其他线程从顶部窃取;
+// 每个任务持有一个原子依赖计数,前驱完成时减一,减到0的线程把它压入自己的队列
+// 调用Run的线程作为0号工作线程参与执行,同一时刻只允许一个Run
+class TaskPool
+{
+public:
+    // 按序号执行任务
+    using Invoke = void (*)(void* context, size_t ordinal);
+
+    explicit TaskPool(size_t threadsNum = std::thread::hardware_concurrency())
+        : threadsNum_(std::max<size_t>(threadsNum, 1)), deques_(std::make_unique<Deque[]>(threadsNum_))
+    {
+        for (size_t self = 1; self < threadsNum_; ++self)
+        {
+            workers_.emplace_back([this, self] { WorkerLoop(self); });
+        }
+    }
+
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+    ~TaskPool()
+    {
+        stop_.store(true, std::memory_order_relaxed);
+        epoch_.fetch_add(1, std::memory_order_release);
+        epoch_.notify_all();
+        for (std::thread& worker : workers_)
+        {
+            worker.join();
+        }
+    }
+
+    size_t ThreadsNum() const { return threadsNum_; }
+
+    // 执行tasksNum个任务,outTo[outStart[i], outStart[i + 1])为i的后继,indegree为各任务前驱数
+    // 返回时全部任务已执行完毕,且其写入对调用者可见;任务不应抛出异常
+    void Run(size_t tasksNum, const uint32_t* indegree, const size_t* outStart, const size_t* outTo,
+             Invoke invoke, void* context)
+    {
+        if (tasksNum == 0)
+        {
+            return;
+        }
+        Reserve(tasksNum);
+        for (size_t i = 0; i < tasksNum; ++i)
+        {
+            counters_[i].store(indegree[i], std::memory_order_relaxed);
+        }
+        for (size_t self = 0; self < threadsNum_; ++self)
+        {
+            deques_[self].Reset();
+        }
+        for (size_t i = 0; i < tasksNum; ++i)
+        {
+            if (indegree[i] == 0)
+            {
+                deques_[0].Push(static_cast<uint32_t>(i));
+            }
+        }
+        outStart_ = outStart;
+        outTo_ = outTo;
+        invoke_ = invoke;
+        context_ = context;
+        remaining_.store(tasksNum, std::memory_order_relaxed);
+        finished_.store(0, std::memory_order_relaxed);
+        // 以上写入经epoch发布给工作线程
+        epoch_.fetch_add(1, std::memory_order_release);
+        epoch_.notify_all();
+
+        Work(0);
+        // 等所有工作线程离开本轮,下一轮才能重置队列
+        for (size_t done = finished_.load(std::memory_order_acquire); done != threadsNum_ - 1;
+             done = finished_.load(std::memory_order_acquire))
+        {
+            finished_.wait(done, std::memory_order_acquire);
+        }
+    }
+
+private:
+    // 固定容量的Chase-Lev双端队列,每轮每个任务至多压入一次,容量不小于任务数即不会溢出
+    struct Deque
+    {
+        alignas(64) std::atomic<int64_t> top{0};
+        alignas(64) std::atomic<int64_t> bottom{0};
+        std::unique_ptr<std::atomic<uint32_t>[]> slots;
+        size_t mask = 0;
+
+        void Reset()
+        {
+            top.store(0, std::memory_order_relaxed);
+            bottom.store(0, std::memory_order_relaxed);
+        }
+
+        void Push(uint32_t task)
+        {
+            int64_t b = bottom.load(std::memory_order_relaxed);
+            slots[static_cast<size_t>(b) & mask].store(task, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+
+        bool Pop(uint32_t& task)
+        {
+            int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+            bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t t = top.load(std::memory_order_relaxed);
+            if (t > b)
+            {
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+            task = slots[static_cast<size_t>(b) & mask].load(std::memory_order_relaxed);
+            if (t == b)
+            {
+                // 只剩最后一个,与窃取者竞争
+                bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return won;
+            }
+            return true;
+        }
+
+        bool Steal(uint32_t& task)
+        {
+            int64_t t = top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t b = bottom.load(std::memory_order_acquire);
+            if (t >= b)
+            {
+                return false;
+            }
+            task = slots[static_cast<size_t>(t) & mask].load(std::memory_order_relaxed);
+            return top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        }
+    };
+
+    // 仅在两轮之间调用,此时工作线程均在等待epoch
+    void Reserve(size_t tasksNum)
+    {
+        if (tasksNum <= capacity_)
+        {
+            return;
+        }
+        capacity_ = std::bit_ceil(tasksNum);
+        counters_ = std::make_unique<std::atomic<uint32_t>[]>(capacity_);
+        for (size_t self = 0; self < threadsNum_; ++self)
+        {
+            deques_[self].slots = std::make_unique<std::atomic<uint32_t>[]>(capacity_);
+            deques_[self].mask = capacity_ - 1;
+        }
+    }
+
+    void WorkerLoop(size_t self)
+    {
+        uint64_t seen = 0;
+        while (true)
+        {
+            epoch_.wait(seen, std::memory_order_acquire);
+            seen = epoch_.load(std::memory_order_acquire);
+            if (stop_.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+            Work(self);
+            finished_.fetch_add(1, std::memory_order_release);
+            finished_.notify_one();
+        }
+    }
+
+    void Work(size_t self)
+    {
+        // 窃取对象按xorshift轮换,避免所有线程同时挤向同一个队列
+        uint32_t seed = static_cast<uint32_t>(self * 2654435761u + 1);
+        while (true)
+        {
+            // 先取ready_再找任务:其后压入的任务或本轮结束都会改变ready_,wait不会错过唤醒
+            uint64_t ready = ready_.load(std::memory_order_acquire);
+            if (remaining_.load(std::memory_order_acquire) == 0)
+            {
+                return;
+            }
+            uint32_t task;
+            if (deques_[self].Pop(task) || StealAny(self, seed, task))
+            {
+                Execute(self, task);
+            }
+            else
+            {
+                // 依赖链上暂无可执行任务时挂起,不占用核心
+                ready_.wait(ready, std::memory_order_acquire);
+            }
+        }
+    }
+
+    bool StealAny(size_t self, uint32_t& seed, uint32_t& task)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        for (size_t i = 0; i < threadsNum_; ++i)
+        {
+            size_t victim = (seed + i) % threadsNum_;
+            if (victim != self && deques_[victim].Steal(task))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Execute(size_t self, uint32_t task)
+    {
+        invoke_(context_, task);
+        for (size_t e = outStart_[task]; e < outStart_[task + 1]; ++e)
+        {
+            uint32_t next = static_cast<uint32_t>(outTo_[e]);
+            if (counters_[next].fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                deques_[self].Push(next);
+                ready_.fetch_add(1, std::memory_order_release);
+                ready_.notify_one();
+            }
+        }
+        if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            ready_.fetch_add(1, std::memory_order_release);
+            ready_.notify_all();
+        }
+    }
+
+    size_t threadsNum_;
+    std::unique_ptr<Deque[]> deques_;
+    std::vector<std::thread> workers_;
+
+    size_t capacity_ = 0;
+    std::unique_ptr<std::atomic<uint32_t>[]> counters_;
+
+    // 本轮任务,由epoch发布
+    const size_t* outStart_ = nullptr;
+    const size_t* outTo_ = nullptr;
+    Invoke invoke_ = nullptr;
+    void* context_ = nullptr;
+
+    alignas(64) std::atomic<size_t> remaining_{0};
+    alignas(64) std::atomic<uint64_t> epoch_{0};
+    // 每压入一个就绪任务或本轮全部完成时加一,空闲的工作线程在此等待
+    alignas(64) std::atomic<uint64_t> ready_{0};
+    std::atomic<size_t> finished_{0};
+    std::atomic<bool> stop_{false};
+};
+
+// 顶点绑定的任务
+template <Vertex N, typename F>
+struct Task
+{
+    using Node = N;
+    F func;
+};
+
+template <Vertex N, typename F>
+Task<N, std::decay_t<F>> Bind(F&& func)
+{
+    return {std::forward<F>(func)};
+}
+
+// 任务图:G的每个顶点绑定一个无参可调用对象,边表示执行先后
+// 拓扑序在编译期求出,图中有环时编译失败
+template <typename G, typename... Tasks>
+class TaskGraph
+{
+    constexpr static auto& adjacency = G::adjacency;
+    constexpr static size_t nodesNum = G::nodesNum;
+
+    static_assert(sizeof...(Tasks) == nodesNum, "every node must be bound to exactly one task");
+
+    constexpr static std::array<typename G::NodeId, sizeof...(Tasks)> taskIds{NodeIdOf<typename Tasks::Node>()...};
+
+    // 序号 -> Tasks中的下标
+    constexpr static std::array<size_t, nodesNum> taskOf = [] {
+        std::array<size_t, nodesNum> result{};
+        for (size_t ordinal = 0; ordinal < nodesNum; ++ordinal)
+        {
+            result[ordinal] = sizeof...(Tasks);
+            for (size_t k = 0; k < sizeof...(Tasks); ++k)
+            {
+                if (taskIds[k] == G::nodeIds[ordinal])
+                {
+                    result[ordinal] = k;
+                }
+            }
+        }
+        return result;
+    }();
+    static_assert(std::find(taskOf.begin(), taskOf.end(), sizeof...(Tasks)) == taskOf.end(),
+                  "every node must be bound to exactly one task");
+
+public:
+    constexpr static std::array<uint32_t, nodesNum> indegree = [] {
+        std::array<uint32_t, nodesNum> result{};
+        for (size_t v = 0; v < nodesNum; ++v)
+        {
+            result[v] = static_cast<uint32_t>(adjacency.inStart[v + 1] - adjacency.inStart[v]);
+        }
+        return result;
+    }();
+
+    // Kahn算法,同时可入队的顶点按序号先后;有环时环上顶点不会入队
+    struct Order
+    {
+        std::array<uint32_t, nodesNum> ordinals{};
+        size_t size = 0;
+    };
+
+    constexpr static Order topology = [] {
+        Order result{};
+        std::array<uint32_t, nodesNum> pending = indegree;
+        for (size_t v = 0; v < nodesNum; ++v)
+        {
+            if (pending[v] == 0)
+            {
+                result.ordinals[result.size++] = static_cast<uint32_t>(v);
+            }
+        }
+        for (size_t head = 0; head < result.size; ++head)
+        {
+            uint32_t u = result.ordinals[head];
+            for (size_t e = adjacency.outStart[u]; e < adjacency.outStart[u + 1]; ++e)
+            {
+                if (--pending[adjacency.outTo[e]] == 0)
+                {
+                    result.ordinals[result.size++] = static_cast<uint32_t>(adjacency.outTo[e]);
+                }
+            }
+        }
+        return result;
+    }();
+    static_assert(topology.size == nodesNum, "task graph must be acyclic");
+
+    explicit TaskGraph(Tasks... tasks) : tasks_(std::move(tasks)...) {}
+
+    // 在当前线程按拓扑序依次执行
+    void RunSequential()
+    {
+        for (uint32_t ordinal : topology.ordinals)
+        {
+            invokers[ordinal](*this);
+        }
+    }
+
+    // 在线程池上执行,无依赖关系的任务并行
+    void Run(TaskPool& pool)
+    {
+        pool.Run(nodesNum, indegree.data(), adjacency.outStart.data(), adjacency.outTo.data(), &Dispatch, this);
+    }
+
+private:
+    template <size_t K>
+    static void Call(TaskGraph& self)
+    {
+        std::get<K>(self.tasks_).func();
+    }
+
+    using Invoker = void (*)(TaskGraph&);
+
+    constexpr static std::array<Invoker, nodesNum> invokers = [] {
+        constexpr std::array<Invoker, sizeof...(Tasks)> byTask = []<size_t... Ks>(std::index_sequence<Ks...>) {
+            return std::array<Invoker, sizeof...(Tasks)>{&Call<Ks>...};
+        }(std::index_sequence_for<Tasks...>{});
+        std::array<Invoker, nodesNum> result{};
+        for (size_t ordinal = 0; ordinal < nodesNum; ++ordinal)
+        {
+            result[ordinal] = byTask[taskOf[ordinal]];
+        }
+        return result;
+    }();
+
+    static void Dispatch(void* context, size_t ordinal) { invokers[ordinal](*static_cast<TaskGraph*>(context)); }
+
+    std::tuple<Tasks...> tasks_;
+};
+
+template <typename G, typename... Tasks>
+TaskGraph<G, Tasks...> MakeTaskGraph(Tasks... tasks)
+{
+    return TaskGraph<G, Tasks...>(std::move(tasks)...);
+}
+
+#endif // !TASK_GRAPH_H
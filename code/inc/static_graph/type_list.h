@@ -8,7 +8,9 @@
 #define TYPE_LIST_H
 
 #include <cstddef>
+#include <cstdint>
 #include <type_traits>
+#include <utility>
 
 template <typename... Ts>
 struct TypeList
@@ -36,6 +38,32 @@ concept TL = requires {
     typename TypeList::type;
 };
 
+template <typename T>
+struct Return
+{
+    using type = T;
+};
+
+// 能表示[0, MaxValue]的最窄无符号整型
+template <size_t MaxValue>
+using SmallestUint_t =
+    std::conditional_t<MaxValue <= UINT8_MAX, uint8_t,
+                       std::conditional_t<MaxValue <= UINT16_MAX, uint16_t,
+                                          std::conditional_t<MaxValue <= UINT32_MAX, uint32_t, uint64_t>>>;
+
+// 首元素
+template <TL In>
+struct Head
+{
+};
+template <typename H, typename... Ts>
+struct Head<TypeList<H, Ts...>> : Return<H>
+{
+};
+
+template <TL In>
+using Head_t = typename Head<In>::type;
+
 // Map
 template <TL In, template <typename> class Func>
 struct Map
@@ -49,29 +77,153 @@ struct Map<TypeList<Ts...>, Func> : TypeList<typename Func<Ts>::type...>
 template <TL In, template <typename> class Func>
 using Map_t = typename Map<In, Func>::type;
 
+// 按下标取元素
+#if defined(__has_builtin) && __has_builtin(__type_pack_element)
+template <TL In, size_t I>
+struct At
+{
+};
+template <size_t I, typename... Ts>
+struct At<TypeList<Ts...>, I> : Return<__type_pack_element<I, Ts...>>
+{
+};
+#else
+namespace type_list_detail {
+template <size_t I, typename T>
+struct Indexed
+{
+};
+
+// 每个元素作为带下标的基类，按下标推导即可取出元素，实例化深度为常数
+template <typename Seq, typename... Ts>
+struct Indexer;
+template <size_t... Is, typename... Ts>
+struct Indexer<std::index_sequence<Is...>, Ts...> : Indexed<Is, Ts>...
+{
+};
+
+template <size_t I, typename T>
+Return<T> Pick(const Indexed<I, T>&);
+} // namespace type_list_detail
+
+template <TL In, size_t I>
+struct At
+{
+};
+template <size_t I, typename... Ts>
+    requires(I < sizeof...(Ts))
+struct At<TypeList<Ts...>, I>
+    : decltype(type_list_detail::Pick<I>(
+          std::declval<type_list_detail::Indexer<std::index_sequence_for<Ts...>, Ts...>>()))
+{
+};
+#endif
+
+template <TL In, size_t I>
+using At_t = typename At<In, I>::type;
+
+namespace type_list_detail {
+// 成员模板只以待查元素为参数，同一列表上的多次查找不必反复比较整个列表类型
+template <typename... Ts>
+struct Finder
+{
+    template <typename E>
+    constexpr static size_t Find()
+    {
+#if defined(__has_builtin) && __has_builtin(__is_same)
+        // 内建比较不实例化is_same_v，去重时比较次数为平方级，差别明显
+        constexpr bool same[] = {__is_same(E, Ts)..., true};
+#else
+        constexpr bool same[] = {std::is_same_v<E, Ts>..., true};
+#endif
+        size_t i = 0;
+        while (!same[i])
+        {
+            ++i;
+        }
+        return i;
+    }
+};
+} // namespace type_list_detail
+
+// 元素首次出现的下标，不存在时为size
+template <TL In, typename E>
+struct IndexOf
+{
+};
+
+template <typename E, typename... Ts>
+struct IndexOf<TypeList<Ts...>, E>
+    : std::integral_constant<size_t, type_list_detail::Finder<Ts...>::template Find<E>()>
+{
+};
+
+template <TL In, typename E>
+constexpr size_t IndexOf_v = IndexOf<In, E>::value;
+
+namespace type_list_detail {
+// 挑选出的下标序列，作为NTTP传给Select
+template <size_t N>
+struct Picks
+{
+    size_t index[N + 1]{};
+    size_t size = 0;
+};
+
+template <size_t N>
+constexpr Picks<N> PickIf(const bool (&keep)[N + 1])
+{
+    Picks<N> picks;
+    for (size_t i = 0; i < N; ++i)
+    {
+        if (keep[i])
+        {
+            picks.index[picks.size++] = i;
+        }
+    }
+    return picks;
+}
+
+template <TL In, auto picks, typename Seq = std::make_index_sequence<picks.size>>
+struct Select;
+template <TL In, auto picks, size_t... Js>
+struct Select<In, picks, std::index_sequence<Js...>> : TypeList<At_t<In, picks.index[Js]>...>
+{
+};
+
+// 区间[Begin, End)
+template <TL In, size_t Begin, typename Seq>
+struct SliceImpl;
+template <TL In, size_t Begin, size_t... Js>
+struct SliceImpl<In, Begin, std::index_sequence<Js...>> : TypeList<At_t<In, Begin + Js>...>
+{
+};
+} // namespace type_list_detail
+
+template <TL In, size_t Begin, size_t End = In::size>
+using Slice_t = typename type_list_detail::SliceImpl<In, Begin, std::make_index_sequence<End - Begin>>::type;
+
 // Filter
-template <TL In, template <typename> class P, TL Out = TypeList<>>
-struct Filter : Out
+template <TL In, template <typename> class P>
+struct Filter
 {
 };
 
-template <template <typename> class P, TL OUT, typename H, typename... Ts>
-struct Filter<TypeList<H, Ts...>, P, OUT>
-    : std::conditional_t<P<H>::value, Filter<TypeList<Ts...>, P, typename OUT::template append<H>>,
-                         Filter<TypeList<Ts...>, P, OUT>>
+template <template <typename> class P, typename... Ts>
+struct Filter<TypeList<Ts...>, P>
 {
+private:
+    constexpr static bool keep[] = {bool(P<Ts>::value)..., false};
+
+public:
+    using type = typename type_list_detail::Select<TypeList<Ts...>,
+                                                   type_list_detail::PickIf<sizeof...(Ts)>(keep)>::type;
 };
 
 template <TL IN, template <typename> class P>
 using Filter_t = typename Filter<IN, P>::type;
 
 // Fold
-template <typename T>
-struct Return
-{
-    using type = T;
-};
-
 template <TL In, typename Init, template <typename, typename> class Op>
 struct Fold : Return<Init>
 {
@@ -101,25 +253,22 @@ template<TL In, TL In2>
 struct Concat : In2::template exportTo<IN::template append> { };
 */
 
-template <TL... In>
-struct Concat;
+namespace type_list_detail {
+template <typename... Ts, typename... Us>
+TypeList<Ts..., Us...> operator+(TypeList<Ts...>, TypeList<Us...>);
 
+// 折叠表达式逐个拼接，不产生递归实例化
 template <TL... In>
-using Concat_t = typename Concat<In...>::type;
+using ConcatAll = decltype((TypeList<>{} + ... + typename In::type{}));
+} // namespace type_list_detail
 
-template <>
-struct Concat<> : TypeList<>
-{
-};
-template <TL In, TL In2, TL... Rest>
-struct Concat<In, In2, Rest...> : Concat<Concat_t<In, In2>, Rest...>
+template <TL... In>
+struct Concat : type_list_detail::ConcatAll<In...>
 {
 };
 
-template <typename... Ts, typename... Ts1>
-struct Concat<TypeList<Ts...>, TypeList<Ts1...>> : TypeList<Ts..., Ts1...>
-{
-};
+template <TL... In>
+using Concat_t = typename Concat<In...>::type;
 
 // 判断类型是否存在
 /*
@@ -142,20 +291,30 @@ template <typename E, typename... Ts>
 struct Elem<TypeList<Ts...>, E> : std::bool_constant<(false || ... || std::is_same_v<E, Ts>)>
 {
 };
-;
 
 template <TL In, typename E>
 constexpr bool Elem_v = Elem<In, E>::value;
 
-// 去重
+// 去重：保留首次出现的元素
 template <TL In>
-class Unique
+struct Unique
 {
-    template <typename Acc, typename E>
-    using Append = std::conditional<Elem_v<Acc, E>, Acc, typename Acc::template append<E>>;
+};
+
+template <typename... Ts>
+struct Unique<TypeList<Ts...>>
+{
+private:
+    using In = TypeList<Ts...>;
+    template <size_t... Is>
+    constexpr static auto Keep(std::index_sequence<Is...>)
+    {
+        using Finder = type_list_detail::Finder<Ts...>;
+        return type_list_detail::PickIf<sizeof...(Ts)>({(Finder::template Find<Ts>() == Is)..., false});
+    }
 
 public:
-    using type = Fold_t<In, TypeList<>, Append>;
+    using type = typename type_list_detail::Select<In, Keep(std::index_sequence_for<Ts...>{})>::type;
 };
 
 template <TL In>
@@ -179,23 +338,98 @@ public:
 template <TL In, template <typename> typename P>
 using Partition_t = Partition<In, P>::type;
 
-// 快速排序
+namespace type_list_detail {
+// 有序列表中满足P的前缀长度，二分查找，递归深度为log(size)
+template <TL In, template <typename> class P, size_t Lo = 0, size_t Hi = In::size>
+constexpr size_t PartitionPoint()
+{
+    if constexpr (Lo == Hi)
+    {
+        return Lo;
+    }
+    else
+    {
+        constexpr size_t mid = Lo + (Hi - Lo) / 2;
+        if constexpr (P<At_t<In, mid>>::value)
+        {
+            return PartitionPoint<In, P, mid + 1, Hi>();
+        }
+        else
+        {
+            return PartitionPoint<In, P, Lo, mid>();
+        }
+    }
+}
+
+// 稳定归并：每个元素的最终位置 = 自身下标 + 另一侧排在它前面的元素个数
+template <TL L, TL R, template <typename, typename> class Cmp>
+class Merge
+{
+    template <typename X>
+    struct Before
+    {
+        template <typename E>
+        using Less = Cmp<E, X>;
+        template <typename E>
+        using NotGreater = std::bool_constant<!Cmp<X, E>::value>;
+    };
+
+    // 左侧元素前面有多少个严格小于它的右侧元素
+    template <TL Side>
+    struct LeftPos;
+    template <typename... Ls>
+    struct LeftPos<TypeList<Ls...>>
+    {
+        constexpr static size_t value[] = {PartitionPoint<R, Before<Ls>::template Less>()..., 0};
+    };
+    // 右侧元素前面有多少个不大于它的左侧元素，相等时左侧在前
+    template <TL Side>
+    struct RightPos;
+    template <typename... Rs>
+    struct RightPos<TypeList<Rs...>>
+    {
+        constexpr static size_t value[] = {PartitionPoint<L, Before<Rs>::template NotGreater>()..., 0};
+    };
+
+    constexpr static auto Sources()
+    {
+        using PosL = LeftPos<typename L::type>;
+        using PosR = RightPos<typename R::type>;
+        Picks<L::size + R::size> picks;
+        for (size_t i = 0; i < L::size; ++i)
+        {
+            picks.index[i + PosL::value[i]] = i;
+        }
+        for (size_t j = 0; j < R::size; ++j)
+        {
+            picks.index[j + PosR::value[j]] = L::size + j;
+        }
+        picks.size = L::size + R::size;
+        return picks;
+    }
+
+public:
+    using type = typename Select<Concat_t<L, R>, Sources()>::type;
+};
+} // namespace type_list_detail
+
+// 归并排序（稳定），递归深度为log(size)
 template <TL In, template <typename, typename> class Cmp>
-struct Sort : TypeList<>
+struct Sort : Return<typename In::type>
 {
 };
 
-template <template <typename, typename> class Cmp, typename Pivot, typename... Ts>
-class Sort<TypeList<Pivot, Ts...>, Cmp>
+template <template <typename, typename> class Cmp, typename... Ts>
+    requires(sizeof...(Ts) > 1)
+class Sort<TypeList<Ts...>, Cmp>
 {
-    template <typename E>
-    using LT = Cmp<E, Pivot>;
-    using P = Partition_t<TypeList<Ts...>, LT>;
-    using SmallerSorted = typename Sort<typename P::Satisfied, Cmp>::type;
-    using BiggerSorted = typename Sort<typename P::Rest, Cmp>::type;
+    using In = TypeList<Ts...>;
+    constexpr static size_t half = sizeof...(Ts) / 2;
+    using Left = typename Sort<Slice_t<In, 0, half>, Cmp>::type;
+    using Right = typename Sort<Slice_t<In, half>, Cmp>::type;
 
 public:
-    using type = Concat_t<typename SmallerSorted::template append<Pivot>, BiggerSorted>;
+    using type = typename type_list_detail::Merge<Left, Right, Cmp>::type;
 };
 
 template <TL In, template <typename, typename> class Cmp>
@@ -0,0 +1,146 @@
+# 编译期开销测量脚本,由compile_cost目标以cmake -P方式调用
+# 对每个合成输入分别编译,记录墙钟时间、峰值内存与模板实例化数,汇总为CSV
+#
+# 输入变量:
+#   PROBE        compile_probe可执行文件
+#   CXX/CXX_ID   编译器及其CMAKE_CXX_COMPILER_ID
+#   INCLUDE_DIR  头文件目录
+#   SOURCE_DIR   合成输入源文件目录(本目录)
+#   OUT_DIR      输出目录,结果写入${OUT_DIR}/compile_cost.csv
+#   TYPES        TypeList规模,逗号分隔
+#   NODES        图顶点数,逗号分隔
+#   DEGREES      图出度(边数=顶点数*出度),逗号分隔
+#   ENTRIES      DataTable记录数,逗号分隔
+#   COUNT        为ON时额外编译一次统计实例化数
+#   SIZE         binutils的size,设置时按NODES与DEGREES分别以两种路径存储方式编译图,
+#                实测目标文件中.rodata与.data.rel.ro的字节数,写入${OUT_DIR}/route_storage.csv
+
+foreach(var PROBE CXX CXX_ID INCLUDE_DIR SOURCE_DIR OUT_DIR)
+  if(NOT DEFINED ${var})
+    message(FATAL_ERROR "compile_cost.cmake: ${var} is not set")
+  endif()
+endforeach()
+
+foreach(var TYPES NODES DEGREES ENTRIES)
+  string(REPLACE "," ";" ${var} "${${var}}")
+endforeach()
+
+file(MAKE_DIRECTORY ${OUT_DIR})
+set(csv ${OUT_DIR}/compile_cost.csv)
+file(WRITE ${csv} "input,size,edges_per_node,wall_ms,peak_rss_kb,instantiations,exit\n")
+
+# 模板实例化计数:GCC统计类布局转储中的模板类,Clang统计-ftime-trace中的实例化事件
+function(count_instantiations name source defines out)
+  set(${out} "" PARENT_SCOPE)
+  if(NOT COUNT)
+    return()
+  endif()
+  set(base ${OUT_DIR}/${name})
+  if(CXX_ID STREQUAL "GNU")
+    execute_process(
+      COMMAND ${CXX} -std=c++20 -I${INCLUDE_DIR} ${defines} -fsyntax-only -fdump-lang-class=${base}.class ${source}
+      RESULT_VARIABLE result OUTPUT_QUIET ERROR_QUIET)
+    if(result EQUAL 0)
+      file(STRINGS ${base}.class classes REGEX "^Class .*<")
+      list(LENGTH classes count)
+      set(${out} ${count} PARENT_SCOPE)
+    endif()
+    file(REMOVE ${base}.class)
+  elseif(CXX_ID MATCHES "Clang")
+    execute_process(
+      COMMAND ${CXX} -std=c++20 -I${INCLUDE_DIR} ${defines} -c -ftime-trace -o ${base}.o ${source}
+      RESULT_VARIABLE result OUTPUT_QUIET ERROR_QUIET)
+    if(result EQUAL 0)
+      file(READ ${base}.json trace)
+      string(REGEX MATCHALL "\"name\":\"Instantiate(Class|Function)\"" events "${trace}")
+      list(LENGTH events count)
+      set(${out} ${count} PARENT_SCOPE)
+    endif()
+    file(REMOVE ${base}.o ${base}.json)
+  endif()
+endfunction()
+
+function(measure input size degree source defines)
+  set(name ${input}_${size})
+  if(NOT degree STREQUAL "")
+    set(name ${name}_d${degree})
+  endif()
+  execute_process(
+    COMMAND ${PROBE} ${CXX} -std=c++20 -I${INCLUDE_DIR} ${defines} -c -o ${OUT_DIR}/${name}.o ${source}
+    OUTPUT_VARIABLE probe ERROR_VARIABLE errors RESULT_VARIABLE result)
+  file(REMOVE ${OUT_DIR}/${name}.o)
+  string(REGEX MATCH "wall_ms=([0-9]+) peak_rss_kb=([0-9]+) exit=([0-9]+)" matched "${probe}")
+  if(NOT matched)
+    message(WARNING "${name}: probe failed: ${probe}${errors}")
+    return()
+  endif()
+  set(wall ${CMAKE_MATCH_1})
+  set(rss ${CMAKE_MATCH_2})
+  set(exit ${CMAKE_MATCH_3})
+  if(exit EQUAL 0)
+    count_instantiations(${name} ${source} "${defines}" count)
+  else()
+    set(count "")
+    string(SUBSTRING "${errors}" 0 400 errors)
+    message(WARNING "${name}: compile failed\n${errors}")
+  endif()
+  file(APPEND ${csv} "${input},${size},${degree},${wall},${rss},${count},${exit}\n")
+  message(STATUS "${name}: ${wall} ms, ${rss} KB, ${count} instantiations")
+endfunction()
+
+foreach(n IN LISTS TYPES)
+  measure(type_list ${n} "" ${SOURCE_DIR}/type_list_compile.cpp "-DTYPES=${n}")
+endforeach()
+
+foreach(n IN LISTS NODES)
+  foreach(d IN LISTS DEGREES)
+    measure(graph ${n} ${d} ${SOURCE_DIR}/graph_compile.cpp "-DGRAPH_NODES=${n};-DGRAPH_DEGREE=${d}")
+  endforeach()
+endforeach()
+
+foreach(n IN LISTS ENTRIES)
+  measure(data_table ${n} "" ${SOURCE_DIR}/data_table_compile.cpp "-DENTRIES=${n}")
+endforeach()
+
+# 路径存储的实测只读数据:PathRef表存放指向顶点数组的指针,PIE下落在.data.rel.ro并带重定位,
+# 仅按sizeof估算会低估,因此以-O2 -fPIE编译后统计两类段的实际大小
+function(measure_storage policy size degree defines)
+  set(obj ${OUT_DIR}/route_storage_${policy}_${size}_d${degree}.o)
+  execute_process(
+    COMMAND ${CXX} -std=c++20 -O2 -fPIE -I${INCLUDE_DIR} ${defines} -c -o ${obj} ${SOURCE_DIR}/graph_compile.cpp
+    RESULT_VARIABLE result ERROR_VARIABLE errors)
+  if(NOT result EQUAL 0)
+    string(SUBSTRING "${errors}" 0 400 errors)
+    message(WARNING "route storage ${policy} ${size}: compile failed\n${errors}")
+    return()
+  endif()
+  execute_process(COMMAND ${SIZE} -A ${obj} OUTPUT_VARIABLE sections RESULT_VARIABLE result)
+  file(REMOVE ${obj})
+  set(rodata 0)
+  set(relro 0)
+  string(REPLACE "\n" ";" sections "${sections}")
+  foreach(line IN LISTS sections)
+    if(line MATCHES "^\\.rodata[^ ]*[ ]+([0-9]+)")
+      math(EXPR rodata "${rodata} + ${CMAKE_MATCH_1}")
+    elseif(line MATCHES "^\\.data\\.rel\\.ro[^ ]*[ ]+([0-9]+)")
+      math(EXPR relro "${relro} + ${CMAKE_MATCH_1}")
+    endif()
+  endforeach()
+  math(EXPR total "${rodata} + ${relro}")
+  file(APPEND ${storage_csv} "${policy},${size},${degree},${rodata},${relro},${total}\n")
+  message(STATUS "route storage ${policy} ${size}_d${degree}: .rodata ${rodata} B, .data.rel.ro ${relro} B")
+endfunction()
+
+if(SIZE)
+  set(storage_csv ${OUT_DIR}/route_storage.csv)
+  file(WRITE ${storage_csv} "policy,nodes,edges_per_node,rodata_bytes,data_rel_ro_bytes,total_bytes\n")
+  foreach(n IN LISTS NODES)
+    foreach(d IN LISTS DEGREES)
+      measure_storage(path_ref ${n} ${d} "-DGRAPH_NODES=${n};-DGRAPH_DEGREE=${d}")
+      measure_storage(next_hop ${n} ${d} "-DGRAPH_NODES=${n};-DGRAPH_DEGREE=${d};-DGRAPH_ROUTE")
+    endforeach()
+  endforeach()
+  message(STATUS "route storage report: ${storage_csv}")
+endif()
+
+message(STATUS "compile cost report: ${csv}")
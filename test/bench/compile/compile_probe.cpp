@@ -0,0 +1,52 @@
+/*	Copyright(C)
+    Author: 479764650@qq.com
+    Description: 编译开销探针,执行给定命令并输出墙钟时间与子进程峰值内存,供compile_cost.cmake调用
+    History: 2026/10/17
+*/
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+
+// 用法: compile_probe <command> [args...]
+// 输出: wall_ms=<毫秒> peak_rss_kb=<KB> exit=<退出码>,命令本身的输出原样透传
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "usage: %s <command> [args...]\n", argv[0]);
+        return 2;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const pid_t pid = fork();
+    if (pid < 0)
+    {
+        std::perror("fork");
+        return 2;
+    }
+    if (pid == 0)
+    {
+        execvp(argv[1], argv + 1);
+        std::perror("execvp");
+        _exit(127);
+    }
+
+    int status = 0;
+    rusage usage{};
+    if (wait4(pid, &status, 0, &usage) < 0)
+    {
+        std::perror("wait4");
+        return 2;
+    }
+    const auto wallMs =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    const int exitCode = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+
+    // Linux下ru_maxrss单位为KB
+    std::printf("wall_ms=%lld peak_rss_kb=%ld exit=%d\n", static_cast<long long>(wallMs), usage.ru_maxrss, exitCode);
+    return exitCode;
+}
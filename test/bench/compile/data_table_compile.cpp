@@ -0,0 +1,57 @@
+// 编译期开销基准:生成ENTRIES个记录的DataTable,记录类型与维度交替变化,实例化全部编译期与运行期访问
+#include <cstdint>
+#include <cstdio>
+#include <tuple>
+#include <utility>
+
+#include "data_table.h"
+
+#ifndef ENTRIES
+#define ENTRIES 10
+#endif
+
+namespace {
+constexpr size_t entries = ENTRIES;
+
+template <size_t I>
+using ValueOf = std::tuple_element_t<I % 4, std::tuple<uint8_t, uint16_t, uint32_t, double>>;
+
+template <size_t... Is>
+auto MakeTable(std::index_sequence<Is...>) -> DataTable<TypeList<Entry<Is, ValueOf<Is>, Is % 3 + 1>...>>;
+
+using Table = decltype(MakeTable(std::make_index_sequence<entries>{}));
+
+// 标量返回值本身,数组返回span
+template <typename V>
+double First(const V& value)
+{
+    if constexpr (requires { value[0]; })
+    {
+        return double(value[0]);
+    }
+    else
+    {
+        return double(value);
+    }
+}
+
+template <size_t... Is>
+double SumAll(const Table& table, std::index_sequence<Is...>)
+{
+    return (0.0 + ... + First(table.template Get<Is>()));
+}
+} // namespace
+
+int main()
+{
+    Table table{};
+    double value[3]{};
+    for (size_t key = 0; key < entries; ++key)
+    {
+        value[0] = double(key);
+        table.SetData(key, value, sizeof(value));
+        table.GetData(key, value, sizeof(value));
+    }
+    std::printf("%zu entries, sum %f\n", entries, SumAll(table, std::make_index_sequence<entries>{}));
+    return 0;
+}
@@ -0,0 +1,60 @@
+// 编译期开销基准:生成GRAPH_NODES个顶点的图并实例化全部最短路径,顶点id为int,可超过256个
+// 每个顶点有环上后继及GRAPH_DEGREE-1条跳跃边,出度为GRAPH_DEGREE(1~3,默认3);定义GRAPH_WEIGHTED时跳跃边带权并按边权求路径
+// 定义GRAPH_ROUTE时改用下一跳矩阵(GetRoute/GetCheapestRoute)查询,用于对比两种路径存储的编译开销与只读数据大小
+#include <cstdio>
+#include <utility>
+
+#include "graph.h"
+
+#ifndef GRAPH_NODES
+#define GRAPH_NODES 10
+#endif
+
+#ifndef GRAPH_DEGREE
+#define GRAPH_DEGREE 3
+#endif
+
+namespace {
+constexpr int nodes = GRAPH_NODES;
+
+template <int I>
+using N = Node<I>;
+
+template <Vertex F, Vertex T, size_t W = 1>
+using EdgeLink = auto (*)(F) -> auto (*)(Weight<W>) -> auto (*)(T) -> void;
+
+template <int... Is>
+auto MakeGraph(std::integer_sequence<int, Is...>)
+#if GRAPH_DEGREE == 1
+    -> Graph<EdgeLink<N<Is>, N<(Is + 1) % nodes>>...>;
+#elif GRAPH_DEGREE == 2
+    -> Graph<EdgeLink<N<Is>, N<(Is + 1) % nodes>>..., EdgeLink<N<Is>, N<(Is * 7 + 3) % nodes>, Is % 3 + 1>...>;
+#else
+    -> Graph<EdgeLink<N<Is>, N<(Is + 1) % nodes>>..., EdgeLink<N<Is>, N<(Is * 7 + 3) % nodes>, Is % 3 + 1>...,
+             EdgeLink<N<Is>, N<(Is * 13 + 5) % nodes>, Is % 5 + 1>...>;
+#endif
+
+using G = decltype(MakeGraph(std::make_integer_sequence<int, nodes>{}));
+} // namespace
+
+int main()
+{
+    size_t total = 0;
+    for (int from = 0; from < nodes; ++from)
+    {
+        for (int to = 0; to < nodes; ++to)
+        {
+#if defined(GRAPH_ROUTE) && defined(GRAPH_WEIGHTED)
+            total += G::GetCheapestRoute(NodeOrdinal{size_t(from)}, NodeOrdinal{size_t(to)}).size();
+#elif defined(GRAPH_ROUTE)
+            total += G::GetRoute(NodeOrdinal{size_t(from)}, NodeOrdinal{size_t(to)}).size();
+#elif defined(GRAPH_WEIGHTED)
+            total += G::GetCheapestPath(NodeOrdinal{size_t(from)}, NodeOrdinal{size_t(to)}).sz;
+#else
+            total += G::GetShortestPath(NodeOrdinal{size_t(from)}, NodeOrdinal{size_t(to)}).sz;
+#endif
+        }
+    }
+    std::printf("%zu nodes, %zu edges, %zu path nodes\n", G::nodesNum, G::edgesNum, total);
+    return 0;
+}
@@ -0,0 +1,43 @@
+// 编译期开销基准:对TYPES个类型(每个重复一次)做Unique/Filter/Sort/IndexOf,衡量TypeList算法的实例化深度与耗时
+#include <cstdio>
+#include <type_traits>
+#include <utility>
+
+#include "type_list.h"
+
+#ifndef TYPES
+#define TYPES 10
+#endif
+
+namespace {
+constexpr size_t types = TYPES;
+
+// 逆序编号,让排序真正移动元素
+template <size_t I>
+struct T : std::integral_constant<size_t, (types - 1 - I % types) * 7 % types>
+{
+};
+
+template <typename E>
+using IsEven = std::bool_constant<E::value % 2 == 0>;
+
+template <typename L, typename R>
+using ValueLess = std::bool_constant<(L::value < R::value)>;
+
+template <size_t... Is>
+auto MakeList(std::index_sequence<Is...>) -> TypeList<T<Is>..., T<Is>...>;
+
+using All = decltype(MakeList(std::make_index_sequence<types>{}));
+using Uniq = Unique_t<All>;
+using Even = Filter_t<Uniq, IsEven>;
+using Sorted = Sort_t<Uniq, ValueLess>;
+} // namespace
+
+int main()
+{
+    static_assert(Uniq::size == types);
+    static_assert(Head_t<Sorted>::value == 0);
+    std::printf("%zu types, %zu unique, %zu even, head %zu\n", All::size, Uniq::size, Even::size,
+                Head_t<Sorted>::value);
+    return 0;
+}
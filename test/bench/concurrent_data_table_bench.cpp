@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "concurrent_data_table.h"
+#include "data_table.h"
+
+namespace {
+using Es = TypeList<Entry<0, uint64_t>, Entry<1, uint64_t[8]>, Entry<2, double>>;
+
+// 对照组:整表加锁
+struct MutexTable
+{
+    std::mutex mutex;
+    DataTable<Es> table;
+
+    bool GetData(size_t key, void* out, size_t len)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return table.GetData(key, out, len);
+    }
+    bool SetData(size_t key, const void* value, size_t len)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return table.SetData(key, value, len);
+    }
+};
+
+// 读者线程由benchmark按ThreadRange创建,另有一个后台写者持续更新记录1
+template <typename Table>
+class OneWriterManyReaders
+{
+public:
+    static Table table;
+    static std::atomic<bool> stop;
+    static std::thread writer;
+
+    static void Start()
+    {
+        uint64_t block[8]{};
+        uint64_t counter = 0;
+        table.SetData(0, &counter, sizeof(counter));
+        table.SetData(1, block, sizeof(block));
+        stop = false;
+        writer = std::thread([] {
+            uint64_t block[8]{};
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                ++block[0];
+                table.SetData(1, block, sizeof(block));
+            }
+        });
+    }
+
+    static void Stop()
+    {
+        stop = true;
+        writer.join();
+    }
+};
+
+template <typename Table>
+Table OneWriterManyReaders<Table>::table;
+template <typename Table>
+std::atomic<bool> OneWriterManyReaders<Table>::stop;
+template <typename Table>
+std::thread OneWriterManyReaders<Table>::writer;
+} // namespace
+
+template <typename Table>
+static void BM_ReadUnderWriter(benchmark::State& state)
+{
+    using Fixture = OneWriterManyReaders<Table>;
+    if (state.thread_index() == 0)
+    {
+        Fixture::Start();
+    }
+    uint64_t block[8];
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Fixture::table.GetData(1, block, sizeof(block)));
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0)
+    {
+        Fixture::Stop();
+    }
+}
+BENCHMARK(BM_ReadUnderWriter<MutexTable>)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_ReadUnderWriter<ConcurrentDataTable<Es>>)->ThreadRange(1, 8)->UseRealTime();
+
+// 读者读记录0,与写者的记录1互不相关;对比区域按缓存行对齐前后读者与写者争用缓存行的开销
+template <typename Table>
+static void BM_ReadOtherKeyUnderWriter(benchmark::State& state)
+{
+    using Fixture = OneWriterManyReaders<Table>;
+    if (state.thread_index() == 0)
+    {
+        Fixture::Start();
+    }
+    uint64_t counter;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Fixture::table.GetData(0, &counter, sizeof(counter)));
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0)
+    {
+        Fixture::Stop();
+    }
+}
+BENCHMARK(BM_ReadOtherKeyUnderWriter<MutexTable>)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_ReadOtherKeyUnderWriter<ConcurrentDataTable<Es>>)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_ReadOtherKeyUnderWriter<ConcurrentDataTable<Es, CacheLayout<cacheLineSize>>>)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
@@ -0,0 +1,594 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "data_table.h"
+#include "data_table_columns.h"
+
+namespace {
+enum Key : size_t
+{
+    ID,
+    PRICE,
+    FLAG,
+    VOLUME,
+};
+
+using Table = DataTable<TypeList<Entry<ID, uint32_t>,
+                                 Entry<PRICE, double>,
+                                 Entry<FLAG, char>,
+                                 Entry<VOLUME, int32_t>>>;
+
+// 对照组:同样字段的普通结构体
+struct Plain
+{
+    uint32_t id;
+    double price;
+    char flag;
+    int32_t volume;
+};
+} // namespace
+
+static void BM_PlainStructGet(benchmark::State& state)
+{
+    Plain plain{1, 2.0, 'c', 4};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(plain);
+        benchmark::DoNotOptimize(plain.price);
+    }
+}
+BENCHMARK(BM_PlainStructGet);
+
+static void BM_DataTableGetKey(benchmark::State& state)
+{
+    Table table{};
+    table.Set<PRICE>(2.0);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(table);
+        benchmark::DoNotOptimize(table.Get<PRICE>());
+    }
+}
+BENCHMARK(BM_DataTableGetKey);
+
+static void BM_DataTableGetData(benchmark::State& state)
+{
+    Table table{};
+    table.Set<PRICE>(2.0);
+    double price = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(table);
+        table.GetData(PRICE, &price, sizeof(price));
+        benchmark::DoNotOptimize(price);
+    }
+}
+BENCHMARK(BM_DataTableGetData);
+
+static void BM_PlainStructSet(benchmark::State& state)
+{
+    Plain plain{};
+    int32_t volume = 0;
+    for (auto _ : state)
+    {
+        plain.volume = ++volume;
+        benchmark::ClobberMemory();
+    }
+    benchmark::DoNotOptimize(plain);
+}
+BENCHMARK(BM_PlainStructSet);
+
+static void BM_DataTableSetKey(benchmark::State& state)
+{
+    Table table{};
+    int32_t volume = 0;
+    for (auto _ : state)
+    {
+        table.Set<VOLUME>(++volume);
+        benchmark::ClobberMemory();
+    }
+    benchmark::DoNotOptimize(table);
+}
+BENCHMARK(BM_DataTableSetKey);
+
+static void BM_DataTableSetData(benchmark::State& state)
+{
+    Table table{};
+    int32_t volume = 0;
+    for (auto _ : state)
+    {
+        ++volume;
+        table.SetData(VOLUME, &volume, sizeof(volume));
+        benchmark::ClobberMemory();
+    }
+    benchmark::DoNotOptimize(table);
+}
+BENCHMARK(BM_DataTableSetData);
+
+// 对照组:键到值的unordered_map,各字段统一按8字节存放
+static std::unordered_map<size_t, uint64_t> MakeMap()
+{
+    return {{ID, 1}, {PRICE, 0}, {FLAG, 'c'}, {VOLUME, 4}};
+}
+
+static void BM_UnorderedMapGetData(benchmark::State& state)
+{
+    auto map = MakeMap();
+    double price = 2.0;
+    std::memcpy(&map[PRICE], &price, sizeof(price));
+    size_t key = PRICE;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(key);
+        std::memcpy(&price, &map.find(key)->second, sizeof(price));
+        benchmark::DoNotOptimize(price);
+    }
+}
+BENCHMARK(BM_UnorderedMapGetData);
+
+static void BM_UnorderedMapSetData(benchmark::State& state)
+{
+    auto map = MakeMap();
+    int32_t volume = 0;
+    size_t key = VOLUME;
+    for (auto _ : state)
+    {
+        ++volume;
+        benchmark::DoNotOptimize(key);
+        std::memcpy(&map.find(key)->second, &volume, sizeof(volume));
+        benchmark::ClobberMemory();
+    }
+    benchmark::DoNotOptimize(map);
+}
+BENCHMARK(BM_UnorderedMapSetData);
+
+namespace {
+// 每个记录维度不同,各自成组,用于对比分组数较多时的派发开销
+template <typename Dispatch, size_t... Is>
+auto MakeManyGroups(std::index_sequence<Is...>) -> DataTable<TypeList<Entry<Is, char, Is + 1>...>, Dispatch>;
+
+template <typename Dispatch>
+using ManyGroups = decltype(MakeManyGroups<Dispatch>(std::make_index_sequence<32>{}));
+} // namespace
+
+template <typename Dispatch>
+static void BM_ManyGroupsGetData(benchmark::State& state)
+{
+    ManyGroups<Dispatch> table{};
+    char buf[32]{};
+    for (size_t key = 0; key < 32; ++key)
+    {
+        table.SetData(key, buf, key + 1);
+    }
+    size_t key = 0;
+    for (auto _ : state)
+    {
+        key = (key + 7) & 31;
+        benchmark::DoNotOptimize(table.GetData(key, buf, 4));
+    }
+}
+BENCHMARK(BM_ManyGroupsGetData<FoldDispatch>);
+BENCHMARK(BM_ManyGroupsGetData<JumpTableDispatch>);
+
+template <typename Dispatch>
+static void BM_ManyGroupsSetData(benchmark::State& state)
+{
+    ManyGroups<Dispatch> table{};
+    char buf[4]{1, 2, 3, 4};
+    size_t key = 0;
+    for (auto _ : state)
+    {
+        key = (key + 7) & 31;
+        benchmark::DoNotOptimize(table.SetData(key, buf, sizeof(buf)));
+    }
+}
+BENCHMARK(BM_ManyGroupsSetData<FoldDispatch>);
+BENCHMARK(BM_ManyGroupsSetData<JumpTableDispatch>);
+
+namespace {
+// 一条消息涉及的16个记录
+template <size_t... Is>
+auto MakeMessage(std::index_sequence<Is...>)
+    -> DataTable<TypeList<Entry<Is, std::conditional_t<Is % 3 == 0, double, uint32_t>>...>>;
+using Message = decltype(MakeMessage(std::make_index_sequence<16>{}));
+
+template <size_t... Is>
+constexpr size_t MessageBytes(std::index_sequence<Is...>)
+{
+    return ((Is % 3 == 0 ? sizeof(double) : sizeof(uint32_t)) + ...);
+}
+constexpr size_t messageBytes = MessageBytes(std::make_index_sequence<16>{});
+
+Message FilledMessage()
+{
+    Message msg{};
+    char value[sizeof(double)]{};
+    for (size_t key = 0; key < 16; ++key)
+    {
+        msg.SetData(key, value);
+    }
+    return msg;
+}
+} // namespace
+
+static void BM_MessageGetDataPerKey(benchmark::State& state)
+{
+    Message msg = FilledMessage();
+    size_t keys[]{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+    size_t lens[16];
+    for (size_t key : keys)
+    {
+        lens[key] = key % 3 == 0 ? sizeof(double) : sizeof(uint32_t);
+    }
+    char out[messageBytes];
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(msg);
+        benchmark::DoNotOptimize(keys);
+        char* pos = out;
+        for (size_t i = 0; i < 16; ++i)
+        {
+            msg.GetData(keys[i], pos, lens[i]);
+            pos += lens[i];
+        }
+        benchmark::DoNotOptimize(out);
+    }
+}
+BENCHMARK(BM_MessageGetDataPerKey);
+
+static void BM_MessageGetManyKeys(benchmark::State& state)
+{
+    Message msg = FilledMessage();
+    char out[messageBytes];
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(msg);
+        msg.GetMany<0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15>(out);
+        benchmark::DoNotOptimize(out);
+    }
+}
+BENCHMARK(BM_MessageGetManyKeys);
+
+static void BM_MessageGetManyBatch(benchmark::State& state)
+{
+    Message msg = FilledMessage();
+    const size_t keys[]{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+    auto batch = *Message::MakeBatch(keys);
+    char out[messageBytes];
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(msg);
+        msg.GetMany(batch, out);
+        benchmark::DoNotOptimize(out);
+    }
+}
+BENCHMARK(BM_MessageGetManyBatch);
+
+namespace {
+using Trade = TypeList<Entry<0, uint32_t>, Entry<1, double>, Entry<2, int32_t>, Entry<3, char[40]>>;
+} // namespace
+
+// 行式存储扫描单列,每行整条记录都会进入缓存
+static void BM_RowsSumColumn(benchmark::State& state)
+{
+    std::vector<DataTable<Trade>> rows(state.range(0));
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+        rows[i].Set<1>(i * 0.5);
+    }
+    for (auto _ : state)
+    {
+        double sum = 0;
+        for (const auto& row : rows)
+        {
+            sum += row.Get<1>();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(double));
+}
+BENCHMARK(BM_RowsSumColumn)->Arg(1 << 16)->Arg(1 << 20);
+
+static void BM_ColumnsSumColumn(benchmark::State& state)
+{
+    DataTableColumns<Trade> columns;
+    for (int64_t i = 0; i < state.range(0); ++i)
+    {
+        columns.Append().Set<1>(i * 0.5);
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(columns.Sum<1>());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(double));
+}
+BENCHMARK(BM_ColumnsSumColumn)->Arg(1 << 16)->Arg(1 << 20);
+
+static void BM_ColumnsCountWhere(benchmark::State& state)
+{
+    DataTableColumns<Trade> columns;
+    for (int64_t i = 0; i < state.range(0); ++i)
+    {
+        columns.Append().Set<2>(static_cast<int32_t>(i % 100));
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(columns.CountWhere<2>([](int32_t v) { return v > 90; }));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int32_t));
+}
+BENCHMARK(BM_ColumnsCountWhere)->Arg(1 << 16)->Arg(1 << 20);
+
+namespace {
+template <size_t... Is>
+auto MakeWide(std::index_sequence<Is...>) -> DataTable<TypeList<Entry<Is, uint64_t>...>>;
+using Wide = decltype(MakeWide(std::make_index_sequence<256>{}));
+} // namespace
+
+// 每个周期仅少量记录变化时,整表复制与增量导出的对比
+static void BM_ReplicateFullTable(benchmark::State& state)
+{
+    Wide table{};
+    std::vector<char> buf(Wide::SerializedBytes());
+    uint64_t value = 0;
+    for (auto _ : state)
+    {
+        for (size_t key = 0; key < 4; ++key)
+        {
+            table.SetData(key * 61, &++value, sizeof(value));
+        }
+        table.Serialize(buf.data(), buf.size());
+        benchmark::DoNotOptimize(buf.data());
+    }
+    state.SetBytesProcessed(state.iterations() * buf.size());
+}
+BENCHMARK(BM_ReplicateFullTable);
+
+static void BM_ReplicateDelta(benchmark::State& state)
+{
+    Wide table{};
+    std::vector<char> buf(Wide::SerializedBytes());
+    uint64_t value = 0;
+    int64_t bytes = 0;
+    for (auto _ : state)
+    {
+        for (size_t key = 0; key < 4; ++key)
+        {
+            table.SetData(key * 61, &++value, sizeof(value));
+        }
+        bytes += table.ExportDelta(buf.data(), buf.size());
+        benchmark::DoNotOptimize(buf.data());
+    }
+    state.SetBytesProcessed(bytes);
+}
+BENCHMARK(BM_ReplicateDelta);
+
+namespace {
+// 稀疏的协议标签作为键
+constexpr size_t sparseTags[]{1001, 1003, 2050, 4096, 7777, 9001, 12000, 15000,
+                              20001, 25000, 30011, 33333, 40017, 50000, 60001, 65535};
+
+template <size_t... Is>
+auto MakeSparse(std::index_sequence<Is...>) -> DataTable<TypeList<Entry<sparseTags[Is], uint64_t>...>>;
+using Sparse = decltype(MakeSparse(std::make_index_sequence<16>{}));
+using DenseForMap = decltype(MakeWide(std::make_index_sequence<16>{}));
+} // namespace
+
+static void BM_SparseKeyGetData(benchmark::State& state)
+{
+    Sparse table{};
+    for (size_t tag : sparseTags)
+    {
+        table.SetData(tag, &tag, sizeof(tag));
+    }
+    size_t i = 0;
+    uint64_t out = 0;
+    for (auto _ : state)
+    {
+        i = (i + 5) & 15;
+        benchmark::DoNotOptimize(table.GetData(sparseTags[i], &out, sizeof(out)));
+    }
+}
+BENCHMARK(BM_SparseKeyGetData);
+
+// 对照组:unordered_map将标签重映射到稠密键
+static void BM_SparseKeyRemapGetData(benchmark::State& state)
+{
+    DenseForMap table{};
+    std::unordered_map<size_t, size_t> remap;
+    for (size_t tag : sparseTags)
+    {
+        size_t key = remap.size();
+        remap[tag] = key;
+        table.SetData(key, &tag, sizeof(tag));
+    }
+    size_t i = 0;
+    uint64_t out = 0;
+    for (auto _ : state)
+    {
+        i = (i + 5) & 15;
+        benchmark::DoNotOptimize(table.GetData(remap.find(sparseTags[i])->second, &out, sizeof(out)));
+    }
+}
+BENCHMARK(BM_SparseKeyRemapGetData);
+
+namespace {
+using Config = DataTable<TypeList<Entry<"latency_ms"_fs, uint32_t>, Entry<"timeout_ms"_fs, uint32_t>,
+                                  Entry<"retries"_fs, uint32_t>, Entry<"window"_fs, uint32_t>,
+                                  Entry<"batch_size"_fs, uint32_t>, Entry<"queue_depth"_fs, uint32_t>,
+                                  Entry<"max_conn"_fs, uint32_t>, Entry<"port"_fs, uint32_t>>>;
+constexpr std::string_view configNames[]{"latency_ms", "timeout_ms", "retries", "window",
+                                         "batch_size", "queue_depth", "max_conn", "port"};
+using ConfigById = decltype(MakeWide(std::make_index_sequence<8>{}));
+} // namespace
+
+static void BM_NamedKeyGetData(benchmark::State& state)
+{
+    Config table{};
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        table.SetData(configNames[i], &i, sizeof(i));
+    }
+    size_t i = 0;
+    uint32_t out = 0;
+    for (auto _ : state)
+    {
+        i = (i + 3) & 7;
+        benchmark::DoNotOptimize(table.GetData(configNames[i], &out, sizeof(out)));
+    }
+}
+BENCHMARK(BM_NamedKeyGetData);
+
+// 对照组:名字经unordered_map转为整型键再访问
+static void BM_NamedKeyMapGetData(benchmark::State& state)
+{
+    ConfigById table{};
+    std::unordered_map<std::string_view, size_t> ids;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        ids[configNames[i]] = i;
+        table.SetData(i, &i, sizeof(i));
+    }
+    size_t i = 0;
+    uint64_t out = 0;
+    for (auto _ : state)
+    {
+        i = (i + 3) & 7;
+        benchmark::DoNotOptimize(table.GetData(ids.find(configNames[i])->second, &out, sizeof(out)));
+    }
+}
+BENCHMARK(BM_NamedKeyMapGetData);
+
+static void BM_NamedKeyCompileTime(benchmark::State& state)
+{
+    Config table{};
+    table.Set<"queue_depth"_fs>(16);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(table.Get<"queue_depth"_fs>());
+    }
+}
+BENCHMARK(BM_NamedKeyCompileTime);
+
+namespace {
+enum Quote : size_t
+{
+    NOTE,
+    SEQ,
+    NAME,
+    LAST,
+    HISTORY,
+    QTY,
+    STATE,
+};
+
+// 热字段LAST/QTY/STATE在默认布局下分散于不同缓存行
+using QuoteEntries = TypeList<Entry<NOTE, char[64]>, Entry<SEQ, uint32_t>, Entry<NAME, char[48]>,
+                              Entry<LAST, double>, Entry<HISTORY, double[16]>, Entry<QTY, uint32_t>,
+                              Entry<STATE, char>>;
+using PackedQuote = DataTable<QuoteEntries>;
+using HotQuote = DataTable<QuoteEntries, JumpTableDispatch, CacheLayout<0, LAST, QTY, STATE>>;
+} // namespace
+
+// 大量表上只读热字段:热字段集中在首个缓存行时每表只触及一行
+template <typename Quotes>
+static void BM_HotFieldScan(benchmark::State& state)
+{
+    std::vector<Quotes> quotes(state.range(0));
+    for (size_t i = 0; i < quotes.size(); ++i)
+    {
+        quotes[i].template Set<LAST>(double(i));
+        quotes[i].template Set<QTY>(uint32_t(i));
+        quotes[i].template Set<STATE>(char(i & 1));
+    }
+    for (auto _ : state)
+    {
+        double sum = 0;
+        for (const Quotes& quote : quotes)
+        {
+            sum += quote.template Get<STATE>() ? quote.template Get<LAST>() * quote.template Get<QTY>() : 0;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.counters["bytes/table"] = sizeof(Quotes);
+}
+BENCHMARK(BM_HotFieldScan<PackedQuote>)->Arg(1 << 16)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_HotFieldScan<HotQuote>)->Arg(1 << 16)->Unit(benchmark::kMicrosecond);
+
+namespace {
+enum Wave : size_t
+{
+    WAVE,
+    RATE,
+};
+
+using WaveTable = DataTable<TypeList<Entry<WAVE, float[256]>, Entry<RATE, uint32_t>>>;
+
+WaveTable MakeWave()
+{
+    WaveTable table{};
+    float samples[256];
+    for (size_t i = 0; i < 256; ++i)
+    {
+        samples[i] = float(i);
+    }
+    table.Set<WAVE>(samples);
+    return table;
+}
+} // namespace
+
+// 只需256个样本中的4个:整条拷贝、部分拷贝、逐元素及编译期span
+static void BM_ArrayGetDataFull(benchmark::State& state)
+{
+    WaveTable table = MakeWave();
+    float samples[256];
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(table);
+        table.GetData(WAVE, samples, sizeof(samples));
+        benchmark::DoNotOptimize(samples);
+    }
+}
+BENCHMARK(BM_ArrayGetDataFull);
+
+static void BM_ArrayGetRange(benchmark::State& state)
+{
+    WaveTable table = MakeWave();
+    float samples[4];
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(table);
+        table.GetRange(WAVE, 100, 4, samples);
+        benchmark::DoNotOptimize(samples);
+    }
+}
+BENCHMARK(BM_ArrayGetRange);
+
+static void BM_ArrayGetElement(benchmark::State& state)
+{
+    WaveTable table = MakeWave();
+    float sample = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(table);
+        table.Get(WAVE, 100, sample);
+        benchmark::DoNotOptimize(sample);
+    }
+}
+BENCHMARK(BM_ArrayGetElement);
+
+static void BM_ArraySpan(benchmark::State& state)
+{
+    WaveTable table = MakeWave();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(table);
+        auto samples = table.Get<WAVE>().subspan<100, 4>();
+        benchmark::DoNotOptimize(samples[0] + samples[3]);
+    }
+}
+BENCHMARK(BM_ArraySpan);
@@ -0,0 +1,334 @@
+#include <benchmark/benchmark.h>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "exhaustive_path_finder.h"
+#include "graph.h"
+#include "runtime_graph.h"
+
+namespace {
+using A = Node<'A'>;
+using B = Node<'B'>;
+using C = Node<'C'>;
+using D = Node<'D'>;
+using E = Node<'E'>;
+
+using Small = Graph<LINK(NODE(A)->NODE(B)->NODE(C)->NODE(D)),
+                    LINK(NODE(A)->NODE(C)),
+                    LINK(NODE(B)->NODE(A)),
+                    LINK(NODE(A)->NODE(E))>;
+
+template <int I>
+using N = Node<char('a' + I)>;
+
+// 12个顶点,全部点对可达
+using Large = Graph<LINK(NODE(N<0>)->NODE(N<1>)->NODE(N<2>)->NODE(N<3>)->NODE(N<4>)->NODE(N<5>)->NODE(N<6>)
+                             ->NODE(N<7>)->NODE(N<8>)->NODE(N<9>)->NODE(N<10>)->NODE(N<11>)),
+                    LINK(NODE(N<0>)->NODE(N<3>)->NODE(N<6>)->NODE(N<9>)),
+                    LINK(NODE(N<2>)->NODE(N<7>)->NODE(N<11>)->NODE(N<0>)),
+                    LINK(NODE(N<5>)->NODE(N<1>))>;
+
+// 带处理器的顶点,拓扑与Large相同
+struct Message
+{
+    uint64_t acc = 0;
+};
+
+template <int I>
+struct Hop
+{
+    constexpr static char id = char('a' + I);
+    static void Handle(Message& msg) { msg.acc = msg.acc * 31 + I; }
+};
+
+using Routed = Graph<LINK(NODE(Hop<0>)->NODE(Hop<1>)->NODE(Hop<2>)->NODE(Hop<3>)->NODE(Hop<4>)->NODE(Hop<5>)
+                              ->NODE(Hop<6>)->NODE(Hop<7>)->NODE(Hop<8>)->NODE(Hop<9>)->NODE(Hop<10>)->NODE(Hop<11>)),
+                     LINK(NODE(Hop<0>)->NODE(Hop<3>)->NODE(Hop<6>)->NODE(Hop<9>)),
+                     LINK(NODE(Hop<2>)->NODE(Hop<7>)->NODE(Hop<11>)->NODE(Hop<0>)),
+                     LINK(NODE(Hop<5>)->NODE(Hop<1>))>;
+
+// 逐个id经switch分派到处理器
+template <int... Is>
+void DispatchById(char id, Message& msg, std::integer_sequence<int, Is...>)
+{
+    switch (id)
+    {
+        // 折叠展开为各个case
+        default:
+            ((id == Hop<Is>::id ? (Hop<Is>::Handle(msg), true) : false) || ...);
+    }
+}
+
+void WalkWithSwitch(PathRef<char> path, Message& msg)
+{
+    for (size_t i = 0; i < path.sz; ++i)
+    {
+        DispatchById(path.path[i], msg, std::make_integer_sequence<int, 12>{});
+    }
+}
+
+// 原有实现:对AllSavedPaths逐项比较
+template <typename G>
+PathRef<char> FoldLookup(char from, char to)
+{
+    return ExhaustivePathFinder<typename G::Edges>::GetShortestPath(from, to);
+}
+
+} // namespace
+
+template <typename G>
+static void BM_GraphPathFold(benchmark::State& state)
+{
+    const auto& ids = G::nodeIds;
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        i = (i + 7) % (G::nodesNum * G::nodesNum);
+        benchmark::DoNotOptimize(FoldLookup<G>(ids[i / G::nodesNum], ids[i % G::nodesNum]));
+    }
+}
+BENCHMARK(BM_GraphPathFold<Small>);
+BENCHMARK(BM_GraphPathFold<Large>);
+
+template <typename G>
+static void BM_GraphPathTable(benchmark::State& state)
+{
+    const auto& ids = G::nodeIds;
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        i = (i + 7) % (G::nodesNum * G::nodesNum);
+        benchmark::DoNotOptimize(G::GetShortestPath(ids[i / G::nodesNum], ids[i % G::nodesNum]));
+    }
+}
+BENCHMARK(BM_GraphPathTable<Small>);
+BENCHMARK(BM_GraphPathTable<Large>);
+
+namespace {
+template <Vertex F, Vertex T>
+using EdgeLink = auto (*)(F) -> auto (*)(T) -> void;
+
+// 规模递增的图:环上后继加一条跳跃边,顶点id为int
+template <int Nodes, int... Is>
+auto MakeSized(std::integer_sequence<int, Is...>)
+    -> Graph<EdgeLink<Node<Is>, Node<(Is + 1) % Nodes>>..., EdgeLink<Node<Is>, Node<(Is * 7 + 3) % Nodes>>...>;
+
+template <int Nodes>
+using Sized = decltype(MakeSized<Nodes>(std::make_integer_sequence<int, Nodes>{}));
+} // namespace
+
+BENCHMARK(BM_GraphPathTable<Sized<16>>);
+BENCHMARK(BM_GraphPathTable<Sized<64>>);
+BENCHMARK(BM_GraphPathTable<Sized<128>>);
+
+// 逐点遍历一条路径:PathRef直接读连续存放的顶点,Route沿下一跳矩阵展开
+template <typename G>
+static void BM_GraphPathWalk(benchmark::State& state)
+{
+    const auto& ids = G::nodeIds;
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        i = (i + 7) % (G::nodesNum * G::nodesNum);
+        PathRef<char> path = G::GetShortestPath(ids[i / G::nodesNum], ids[i % G::nodesNum]);
+        for (size_t n = 0; n < path.sz; ++n)
+        {
+            benchmark::DoNotOptimize(path.path[n]);
+        }
+    }
+}
+BENCHMARK(BM_GraphPathWalk<Small>);
+BENCHMARK(BM_GraphPathWalk<Large>);
+
+template <typename G>
+static void BM_GraphRouteWalk(benchmark::State& state)
+{
+    const auto& ids = G::nodeIds;
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        i = (i + 7) % (G::nodesNum * G::nodesNum);
+        for (char id : G::GetRoute(ids[i / G::nodesNum], ids[i % G::nodesNum]))
+        {
+            benchmark::DoNotOptimize(id);
+        }
+    }
+}
+BENCHMARK(BM_GraphRouteWalk<Small>);
+BENCHMARK(BM_GraphRouteWalk<Large>);
+
+// 运行期图:静态拓扑之上随机加边,顶点数由参数给出,平均出度8
+static RuntimeGraph<int> RandomRuntimeGraph(int nodes)
+{
+    RuntimeGraph<int> graph;
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> pick(0, nodes - 1);
+    for (int i = 0; i < nodes * 8; ++i)
+    {
+        graph.AddEdge(pick(rng), pick(rng));
+    }
+    graph.Commit();
+    return graph;
+}
+
+static void BM_RuntimeBfs(benchmark::State& state)
+{
+    RuntimeGraph<int> graph = RandomRuntimeGraph(static_cast<int>(state.range(0)));
+    std::vector<int> sources{0};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(graph.Bfs(sources).data());
+    }
+}
+BENCHMARK(BM_RuntimeBfs)->Arg(1 << 12)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
+
+static void BM_RuntimeParallelBfs(benchmark::State& state)
+{
+    RuntimeGraph<int> graph = RandomRuntimeGraph(static_cast<int>(state.range(0)));
+    std::vector<int> sources{0};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(graph.ParallelBfs(sources, static_cast<size_t>(state.range(1))).data());
+    }
+}
+BENCHMARK(BM_RuntimeParallelBfs)
+    ->Args({1 << 12, 4})
+    ->Args({1 << 20, 1})
+    ->Args({1 << 20, 4})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+static void BM_RuntimeShortestPath(benchmark::State& state)
+{
+    RuntimeGraph<int> graph = RandomRuntimeGraph(static_cast<int>(state.range(0)));
+    int i = 0;
+    for (auto _ : state)
+    {
+        i = (i + 7919) % static_cast<int>(state.range(0));
+        benchmark::DoNotOptimize(graph.GetShortestPath(0, i));
+    }
+}
+BENCHMARK(BM_RuntimeShortestPath)->Arg(1 << 12)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
+
+// 固定起止点:遍历PathRef逐点switch分派,对比编译期展开的Run<From, To>
+static void BM_RouteSwitchFixed(benchmark::State& state)
+{
+    Message msg;
+    char from = 'f';
+    char to = 'a';
+    for (auto _ : state)
+    {
+        // 阻止编译器把整条路径常量折叠,与实际从消息中取出起止点一致
+        benchmark::DoNotOptimize(from);
+        benchmark::DoNotOptimize(to);
+        WalkWithSwitch(Routed::GetShortestPath(from, to), msg);
+        benchmark::DoNotOptimize(msg.acc);
+    }
+}
+BENCHMARK(BM_RouteSwitchFixed);
+
+static void BM_RouteFusedFixed(benchmark::State& state)
+{
+    Message msg;
+    for (auto _ : state)
+    {
+        Routed::Run<Hop<5>, Hop<0>>(msg);
+        benchmark::DoNotOptimize(msg.acc);
+    }
+}
+BENCHMARK(BM_RouteFusedFixed);
+
+// 运行期起止点轮换:switch分派对比跳转表
+static void BM_RouteSwitchRuntime(benchmark::State& state)
+{
+    const auto& ids = Routed::nodeIds;
+    Message msg;
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        i = (i + 7) % (Routed::nodesNum * Routed::nodesNum);
+        WalkWithSwitch(Routed::GetShortestPath(ids[i / Routed::nodesNum], ids[i % Routed::nodesNum]), msg);
+        benchmark::DoNotOptimize(msg.acc);
+    }
+}
+BENCHMARK(BM_RouteSwitchRuntime);
+
+static void BM_RouteJumpTable(benchmark::State& state)
+{
+    const auto& ids = Routed::nodeIds;
+    Message msg;
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        i = (i + 7) % (Routed::nodesNum * Routed::nodesNum);
+        Routed::Run(ids[i / Routed::nodesNum], ids[i % Routed::nodesNum], msg);
+        benchmark::DoNotOptimize(msg.acc);
+    }
+}
+BENCHMARK(BM_RouteJumpTable);
+
+// 可达性:闭包位测试对比由路径表判断
+template <typename G>
+static void BM_GraphReachPath(benchmark::State& state)
+{
+    const auto& ids = G::nodeIds;
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        i = (i + 7) % (G::nodesNum * G::nodesNum);
+        benchmark::DoNotOptimize(G::GetShortestPath(ids[i / G::nodesNum], ids[i % G::nodesNum]).sz > 0);
+    }
+}
+BENCHMARK(BM_GraphReachPath<Large>);
+
+template <typename G>
+static void BM_GraphReachClosure(benchmark::State& state)
+{
+    const auto& ids = G::nodeIds;
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        i = (i + 7) % (G::nodesNum * G::nodesNum);
+        benchmark::DoNotOptimize(G::IsReachable(ids[i / G::nodesNum], ids[i % G::nodesNum]));
+    }
+}
+BENCHMARK(BM_GraphReachClosure<Large>);
+
+// 集合查询:起点可达的顶点中有多少属于给定集合
+template <typename G>
+static void BM_GraphReachCountCommon(benchmark::State& state)
+{
+    constexpr typename G::ReachSet targets = G::MakeNodeSet({NodeOrdinal{1}, NodeOrdinal{4}, NodeOrdinal{9}});
+    const auto& ids = G::nodeIds;
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        i = (i + 1) % G::nodesNum;
+        benchmark::DoNotOptimize(G::ReachableFrom(ids[i]).CountCommon(targets));
+    }
+}
+BENCHMARK(BM_GraphReachCountCommon<Large>);
+
+// 惰性枚举:每对起止点取前k条路径
+template <typename G>
+static void BM_GraphEnumeratePaths(benchmark::State& state)
+{
+    const auto& ids = G::nodeIds;
+    size_t k = static_cast<size_t>(state.range(0));
+    size_t i = 0;
+    size_t paths = 0;
+    for (auto _ : state)
+    {
+        i = (i + 7) % (G::nodesNum * G::nodesNum);
+        for (PathRef<char> path : G::EnumeratePaths(ids[i / G::nodesNum], ids[i % G::nodesNum], k))
+        {
+            benchmark::DoNotOptimize(path.path);
+            ++paths;
+        }
+    }
+    state.counters["paths"] = benchmark::Counter(static_cast<double>(paths), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_GraphEnumeratePaths<Large>)->Arg(1)->Arg(3)->Arg(1000);
@@ -0,0 +1,113 @@
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <vector>
+
+// 对应mem_operate_test.cpp中的拷贝场景
+namespace {
+struct Person
+{
+    int age;
+    char name[20];
+};
+} // namespace
+
+// 短字符串连同结尾0一起拷贝
+static void BM_MemcpyString(benchmark::State& state)
+{
+    char src[] = "Hello, World!";
+    char dest[20];
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(src);
+        std::memcpy(dest, src, sizeof(src));
+        benchmark::DoNotOptimize(dest);
+    }
+}
+BENCHMARK(BM_MemcpyString);
+
+// 零字节拷贝:运行期长度,避免被直接消除
+static void BM_MemcpyZero(benchmark::State& state)
+{
+    char src[] = "No copy";
+    char dest[10] = "original";
+    size_t len = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(len);
+        std::memcpy(dest, src, len);
+        benchmark::DoNotOptimize(dest);
+    }
+}
+BENCHMARK(BM_MemcpyZero);
+
+// 源与目的为同一地址:memcpy要求两者不重叠,此场景只能用memmove
+static void BM_MemmoveSameAddress(benchmark::State& state)
+{
+    int data = 42;
+    int* ptr = &data;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(ptr);
+        std::memmove(ptr, ptr, sizeof(data));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_MemmoveSameAddress);
+
+// POD结构体:memcpy与赋值
+static void BM_MemcpyStruct(benchmark::State& state)
+{
+    Person src{30, "Alice"};
+    Person dest{};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(src);
+        std::memcpy(&dest, &src, sizeof(src));
+        benchmark::DoNotOptimize(dest);
+    }
+}
+BENCHMARK(BM_MemcpyStruct);
+
+static void BM_AssignStruct(benchmark::State& state)
+{
+    Person src{30, "Alice"};
+    Person dest{};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(src);
+        dest = src;
+        benchmark::DoNotOptimize(dest);
+    }
+}
+BENCHMARK(BM_AssignStruct);
+
+// 不同长度的整块拷贝
+static void BM_MemcpyBlock(benchmark::State& state)
+{
+    const size_t len = state.range(0);
+    std::vector<char> src(len, 'x');
+    std::vector<char> dest(len);
+    for (auto _ : state)
+    {
+        std::memcpy(dest.data(), src.data(), len);
+        benchmark::DoNotOptimize(dest.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(len));
+}
+BENCHMARK(BM_MemcpyBlock)->RangeMultiplier(8)->Range(8, 1 << 20);
+
+// 内存重叠:memcpy行为未定义,改用memmove
+static void BM_MemmoveOverlap(benchmark::State& state)
+{
+    const size_t len = state.range(0);
+    std::vector<char> buffer(len + 1, 'x');
+    for (auto _ : state)
+    {
+        std::memmove(buffer.data() + 1, buffer.data(), len);
+        benchmark::DoNotOptimize(buffer.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(len));
+}
+BENCHMARK(BM_MemmoveOverlap)->RangeMultiplier(8)->Range(8, 1 << 20);
@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <utility>
+
+#include "task_graph.h"
+
+namespace {
+template <int I>
+using N = Node<char('a' + I)>;
+
+// 起点a扇出到16个并列阶段,再汇聚到终点r
+template <int... Is>
+using FanOutOf = Graph<LINK(NODE(N<0>)->NODE(N<Is + 1>)->NODE(N<17>))...>;
+
+template <int... Is>
+FanOutOf<Is...> MakeFanOut(std::integer_sequence<int, Is...>);
+
+using FanOut = decltype(MakeFanOut(std::make_integer_sequence<int, 16>{}));
+
+// 每个阶段做一段与输入相关的整数运算,work为迭代次数
+uint64_t Stage(uint64_t seed, int64_t work)
+{
+    for (int64_t i = 0; i < work; ++i)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+    }
+    return seed;
+}
+
+struct FanOutState
+{
+    int64_t work = 0;
+    uint64_t source = 0;
+    uint64_t stages[16]{};
+    uint64_t sink = 0;
+};
+
+template <int... Is>
+auto MakeTasks(FanOutState& s, std::integer_sequence<int, Is...>)
+{
+    return MakeTaskGraph<FanOut>(Bind<N<0>>([&s] { s.source = Stage(1, s.work); }),
+                                 Bind<N<Is + 1>>([&s] { s.stages[Is] = Stage(s.source + Is, s.work); })...,
+                                 Bind<N<17>>([&s] {
+                                     uint64_t sum = 0;
+                                     for (uint64_t v : s.stages)
+                                     {
+                                         sum += v;
+                                     }
+                                     s.sink = Stage(sum, s.work);
+                                 }));
+}
+} // namespace
+
+static void BM_TaskGraphSequential(benchmark::State& state)
+{
+    FanOutState s{state.range(0)};
+    auto tasks = MakeTasks(s, std::make_integer_sequence<int, 16>{});
+    for (auto _ : state)
+    {
+        tasks.RunSequential();
+        benchmark::DoNotOptimize(s.sink);
+    }
+}
+BENCHMARK(BM_TaskGraphSequential)->Arg(1 << 10)->Arg(1 << 16)->Unit(benchmark::kMicrosecond);
+
+static void BM_TaskGraphPool(benchmark::State& state)
+{
+    FanOutState s{state.range(0)};
+    auto tasks = MakeTasks(s, std::make_integer_sequence<int, 16>{});
+    TaskPool pool(static_cast<size_t>(state.range(1)));
+    for (auto _ : state)
+    {
+        tasks.Run(pool);
+        benchmark::DoNotOptimize(s.sink);
+    }
+}
+BENCHMARK(BM_TaskGraphPool)
+    ->Args({1 << 10, 1})
+    ->Args({1 << 10, 4})
+    ->Args({1 << 16, 1})
+    ->Args({1 << 16, 4})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
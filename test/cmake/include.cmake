@@ -1,2 +1,4 @@
 include_directories(${CMAKE_SOURCE_DIR}/test/googletest/googlemock/include)
-include_directories(${CMAKE_SOURCE_DIR}/test/googletest/googletest/include)
\ No newline at end of file
+include_directories(${CMAKE_SOURCE_DIR}/test/googletest/googletest/include)
+include_directories(${CMAKE_SOURCE_DIR}/test/benchmark/include)
+include_directories(${CMAKE_SOURCE_DIR}/test/common)
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "concurrent_data_table.h"
+
+namespace {
+enum Key : size_t
+{
+    COUNTER,
+    BLOCK,
+    FLAG,
+};
+
+using Table = ConcurrentDataTable<TypeList<Entry<COUNTER, uint64_t>, Entry<BLOCK, uint64_t[8]>, Entry<FLAG, char>>>;
+} // namespace
+
+TEST(ConcurrentDataTable, GetSet)
+{
+    Table table;
+    uint64_t counter = 0;
+    EXPECT_FALSE(table.GetData(COUNTER, &counter));
+    EXPECT_FALSE(table.Has<FLAG>());
+    table.Set<FLAG>('y');
+    EXPECT_TRUE(table.Has<FLAG>());
+    EXPECT_EQ(table.Get<FLAG>(), 'y');
+
+    counter = 5;
+    EXPECT_TRUE(table.SetData(COUNTER, &counter, sizeof(counter)));
+    EXPECT_FALSE(table.SetData(FLAG + 1, &counter, sizeof(counter)));
+    uint64_t out = 0;
+    EXPECT_TRUE(table.GetData(COUNTER, &out, sizeof(out)));
+    EXPECT_EQ(out, 5u);
+
+    table.Set<BLOCK>({1, 2, 3, 4, 5, 6, 7, 8});
+    EXPECT_EQ(table.Get<BLOCK>()[7], 8u);
+}
+
+// 写者持续写入每个元素都相同的数组,读者读到的数组必须完整一致
+TEST(ConcurrentDataTable, TornFreeStress)
+{
+    Table table;
+    uint64_t init[8]{};
+    table.Set<BLOCK>(init);
+
+    constexpr uint64_t writes = 200000;
+    std::atomic<bool> done{false};
+    std::atomic<size_t> torn{0};
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 3; ++i)
+    {
+        readers.emplace_back([&] {
+            uint64_t last = 0;
+            while (!done.load(std::memory_order_acquire))
+            {
+                uint64_t block[8]{};
+                table.GetData(BLOCK, block, sizeof(block));
+                for (uint64_t v : block)
+                {
+                    torn += v != block[0];
+                }
+                // 单写者下读到的版本单调不减
+                torn += block[0] < last;
+                last = block[0];
+            }
+        });
+    }
+
+    for (uint64_t n = 1; n <= writes; ++n)
+    {
+        uint64_t block[8];
+        std::fill_n(block, 8, n);
+        table.Set<BLOCK>(block);
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+    EXPECT_EQ(torn.load(), 0u);
+    EXPECT_EQ(table.Get<BLOCK>()[3], writes);
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "data_table_columns.h"
+
+namespace {
+enum Key : size_t
+{
+    ID,
+    PRICE,
+    QTY,
+    TAGS,
+};
+
+using Es = TypeList<Entry<ID, uint32_t>, Entry<PRICE, double>, Entry<QTY, int16_t>, Entry<TAGS, char[3]>>;
+} // namespace
+
+TEST(DataTableColumns, AppendErase)
+{
+    DataTableColumns<Es> table;
+    EXPECT_EQ(table.Rows(), 0u);
+    EXPECT_FALSE(table.Min<PRICE>());
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        auto row = table.Append();
+        row.Set<ID>(i);
+        row.Set<PRICE>(i * 0.5);
+        int16_t qty = static_cast<int16_t>(i % 10) - 5;
+        EXPECT_TRUE(row.SetData(QTY, &qty, sizeof(qty)));
+        if (i % 2 == 0)
+        {
+            row.Set<TAGS>({'a', 'b', char('0' + i % 10)});
+        }
+    }
+    EXPECT_EQ(table.Rows(), 100u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(table.ColumnView<PRICE>().data()) % 64, 0u);
+
+    auto row = table.Row(42);
+    EXPECT_EQ(row.Get<ID>(), 42u);
+    EXPECT_TRUE(row.Has<TAGS>());
+    EXPECT_EQ(row.Get<TAGS>()[2], '2');
+    char tags[3]{};
+    EXPECT_FALSE(table.Row(43).GetData(TAGS, tags));
+    EXPECT_TRUE(row.GetData(TAGS, tags, sizeof(tags)));
+    EXPECT_EQ(tags[0], 'a');
+    row.Ref<PRICE>() = -1;
+    EXPECT_EQ(table.Row(42).Get<PRICE>(), -1);
+
+    table.Erase(0);
+    table.Erase(1000);
+    EXPECT_EQ(table.Rows(), 99u);
+    EXPECT_EQ(table.Row(0).Get<ID>(), 1u);
+    EXPECT_FALSE(table.Row(0).Has<TAGS>());
+    EXPECT_TRUE(table.Row(1).Has<TAGS>());
+    EXPECT_EQ(table.Row(98).Get<ID>(), 99u);
+}
+
+TEST(DataTableColumns, ColumnKernels)
+{
+    DataTableColumns<Es> table;
+    for (uint32_t i = 0; i < 37; ++i)
+    {
+        auto row = table.Append();
+        row.Set<ID>(i);
+        row.Set<PRICE>(i * 0.5);
+        row.Set<QTY>(static_cast<int16_t>(i % 10) - 5);
+    }
+    EXPECT_EQ(table.Sum<ID>(), 36u * 37 / 2);
+    EXPECT_DOUBLE_EQ(table.Sum<PRICE>(), 36 * 37 / 4.0);
+    EXPECT_EQ(*table.Min<QTY>(), -5);
+    EXPECT_EQ(*table.Max<QTY>(), 4);
+    EXPECT_EQ(*table.Max<PRICE>(), 18);
+    EXPECT_EQ(table.CountWhere<QTY>([](int16_t v) { return v < 0; }), 20u);
+    auto rows = table.Filter<PRICE>([](double v) { return v >= 17; });
+    EXPECT_EQ(rows, (std::vector<size_t>{34, 35, 36}));
+}
+
+TEST(DataTableColumns, Move)
+{
+    static_assert(std::is_nothrow_move_constructible_v<DataTableColumns<Es>> &&
+                  std::is_nothrow_move_assignable_v<DataTableColumns<Es>>);
+    auto make = [](uint32_t rows) {
+        DataTableColumns<Es> table;
+        for (uint32_t i = 0; i < rows; ++i)
+        {
+            table.Append().Set<ID>(i);
+        }
+        return table;
+    };
+
+    std::vector<DataTableColumns<Es>> tables;
+    tables.push_back(make(3));
+    tables.push_back(make(5));
+    EXPECT_EQ(tables[0].Sum<ID>(), 3u);
+    EXPECT_EQ(tables[1].Rows(), 5u);
+
+    DataTableColumns<Es> moved = std::move(tables[1]);
+    EXPECT_EQ(tables[1].Rows(), 0u);
+    EXPECT_EQ(moved.Sum<ID>(), 10u);
+    tables[1] = make(2);
+    moved = std::move(tables[1]);
+    EXPECT_EQ(moved.Rows(), 2u);
+    EXPECT_EQ(moved.Row(1).Get<ID>(), 1u);
+    EXPECT_EQ(tables[1].Rows(), 0u);
+    tables[1].Append().Set<ID>(7); // 移动后的源对象可继续使用
+    EXPECT_EQ(tables[1].Sum<ID>(), 7u);
+}
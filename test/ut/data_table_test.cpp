@@ -0,0 +1,546 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "data_table.h"
+#include "data_table_view.h"
+
+namespace {
+enum Key : size_t
+{
+    ID,
+    PRICE,
+    FLAG,
+    VOLUME,
+    SAMPLES,
+};
+
+using Es = TypeList<Entry<ID, uint32_t>,
+                    Entry<PRICE, double>,
+                    Entry<FLAG, char>,
+                    Entry<VOLUME, int32_t>,
+                    Entry<SAMPLES, int16_t[4]>>;
+using Table = DataTable<Es>;
+} // namespace
+
+TEST(DataTable, RuntimeGetSet)
+{
+    Table table{};
+    uint32_t id = 0;
+    EXPECT_FALSE(table.GetData(ID, &id)); // 未设置
+    EXPECT_FALSE(table.SetData(SAMPLES + 1, &id));
+
+    uint32_t in = 42;
+    EXPECT_TRUE(table.SetData(ID, &in, sizeof(in)));
+    EXPECT_TRUE(table.GetData(ID, &id, sizeof(id)));
+    EXPECT_EQ(id, 42u);
+
+    double price = 3.5;
+    int32_t volume = -7;
+    EXPECT_TRUE(table.SetData(PRICE, &price, sizeof(price)));
+    EXPECT_TRUE(table.SetData(VOLUME, &volume, sizeof(volume)));
+    double outPrice = 0;
+    int32_t outVolume = 0;
+    EXPECT_TRUE(table.GetData(PRICE, &outPrice, sizeof(outPrice)));
+    EXPECT_TRUE(table.GetData(VOLUME, &outVolume, sizeof(outVolume)));
+    EXPECT_EQ(outPrice, 3.5);
+    EXPECT_EQ(outVolume, -7);
+
+    int16_t samples[4]{1, 2, 3, 4};
+    int16_t outSamples[4]{};
+    EXPECT_TRUE(table.SetData(SAMPLES, samples, sizeof(samples)));
+    EXPECT_TRUE(table.GetData(SAMPLES, outSamples, sizeof(outSamples)));
+    EXPECT_EQ(outSamples[3], 4);
+}
+
+TEST(DataTable, CompileTimeAccess)
+{
+    Table table{};
+    static_assert(std::is_same_v<decltype(table.Get<PRICE>()), double>);
+    static_assert(std::is_same_v<decltype(table.Ref<ID>()), uint32_t &>);
+    static_assert(std::is_same_v<decltype(table.Get<SAMPLES>()), std::span<const int16_t, 4>>);
+    static_assert(std::is_same_v<decltype(table.Ref<SAMPLES>()), std::span<int16_t, 4>>);
+
+    EXPECT_FALSE(table.Has<PRICE>());
+    table.Set<PRICE>(1.25);
+    table.Set<FLAG>('x');
+    table.Set<SAMPLES>({5, 6, 7, 8});
+    EXPECT_TRUE(table.Has<PRICE>());
+    EXPECT_EQ(table.Get<PRICE>(), 1.25);
+    EXPECT_EQ(table.Get<FLAG>(), 'x');
+    EXPECT_EQ(table.Get<SAMPLES>()[2], 7);
+
+    // 编译期与运行期接口读写同一存储
+    double price = 0;
+    EXPECT_TRUE(table.GetData(PRICE, &price, sizeof(price)));
+    EXPECT_EQ(price, 1.25);
+    uint32_t id = 9;
+    EXPECT_TRUE(table.SetData(ID, &id, sizeof(id)));
+    EXPECT_EQ(table.Get<ID>(), 9u);
+
+    table.Ref<ID>() = 10;
+    table.Ref<SAMPLES>()[0] = -1;
+    EXPECT_EQ(table.Get<ID>(), 10u);
+    int16_t samples[4]{};
+    EXPECT_TRUE(table.GetData(SAMPLES, samples, sizeof(samples)));
+    EXPECT_EQ(samples[0], -1);
+}
+
+TEST(DataTable, DispatchPolicy)
+{
+    DataTable<Es, FoldDispatch> foldTable{};
+    Table jumpTable{};
+    for (size_t key : {ID, PRICE, FLAG, VOLUME, SAMPLES})
+    {
+        uint64_t in = 0x0102030405060708 + key;
+        EXPECT_TRUE(foldTable.SetData(key, &in, sizeof(in)));
+        EXPECT_TRUE(jumpTable.SetData(key, &in, sizeof(in)));
+    }
+    for (size_t key : {ID, PRICE, FLAG, VOLUME, SAMPLES})
+    {
+        uint64_t foldOut = 0;
+        uint64_t jumpOut = 0;
+        EXPECT_TRUE(foldTable.GetData(key, &foldOut, sizeof(foldOut)));
+        EXPECT_TRUE(jumpTable.GetData(key, &jumpOut, sizeof(jumpOut)));
+        EXPECT_EQ(foldOut, jumpOut);
+    }
+    EXPECT_EQ(jumpTable.Get<FLAG>(), char(0x08 + FLAG));
+    EXPECT_EQ(foldTable.Get<VOLUME>(), int32_t(0x05060708 + VOLUME));
+}
+
+TEST(DataTable, BatchAccess)
+{
+    Table table{};
+    table.Set<ID>(7);
+    table.Set<PRICE>(2.5);
+    table.Set<VOLUME>(-3);
+
+    // 编译期键列表,缓冲区按键列表顺序紧密排列
+    char packed[sizeof(double) + sizeof(uint32_t) + sizeof(int32_t)]{};
+    EXPECT_TRUE((table.GetMany<PRICE, ID, VOLUME>(packed)));
+    double price = 0;
+    uint32_t id = 0;
+    int32_t volume = 0;
+    memcpy(&price, packed, sizeof(price));
+    memcpy(&id, packed + sizeof(price), sizeof(id));
+    memcpy(&volume, packed + sizeof(price) + sizeof(id), sizeof(volume));
+    EXPECT_EQ(price, 2.5);
+    EXPECT_EQ(id, 7u);
+    EXPECT_EQ(volume, -3);
+    EXPECT_FALSE((table.GetMany<ID, FLAG>(packed))); // FLAG未设置
+
+    std::tuple<uint32_t, int32_t, std::array<int16_t, 4>> in{11, 12, {1, 2, 3, 4}};
+    table.SetMany<ID, VOLUME, SAMPLES>(in);
+    std::tuple<uint32_t, int32_t, std::array<int16_t, 4>> out{};
+    EXPECT_TRUE((table.GetMany<ID, VOLUME, SAMPLES>(out)));
+    EXPECT_EQ(in, out);
+
+    // 运行期键列表
+    EXPECT_FALSE(Table::MakeBatch(std::array<size_t, 1>{SAMPLES + 1}));
+    EXPECT_FALSE(Table::MakeBatch(std::array<size_t, 2>{ID, ID}));           // 重复键
+    EXPECT_FALSE(Table::MakeBatch(std::vector<size_t>(Es::size + 1, PRICE))); // 重复至超过记录数
+    const size_t keys[]{VOLUME, ID, FLAG};
+    auto batch = Table::MakeBatch(keys);
+    ASSERT_TRUE(batch);
+    EXPECT_EQ(batch->Bytes(), sizeof(int32_t) + sizeof(uint32_t) + sizeof(char));
+    char buf[sizeof(int32_t) + sizeof(uint32_t) + sizeof(char)]{};
+    EXPECT_FALSE(table.GetMany(*batch, buf));
+    int32_t newVolume = 100;
+    uint32_t newId = 200;
+    memcpy(buf, &newVolume, sizeof(newVolume));
+    memcpy(buf + sizeof(newVolume), &newId, sizeof(newId));
+    buf[sizeof(newVolume) + sizeof(newId)] = 'z';
+    table.SetMany(*batch, buf);
+    EXPECT_EQ(table.Get<VOLUME>(), 100);
+    EXPECT_EQ(table.Get<ID>(), 200u);
+    EXPECT_EQ(table.Get<FLAG>(), 'z');
+    char back[sizeof(buf)]{};
+    EXPECT_TRUE(table.GetMany(*batch, back));
+    EXPECT_EQ(memcmp(buf, back, sizeof(buf)), 0);
+}
+
+TEST(DataTable, BatchPlanMerge)
+{
+    // 槽位与缓冲区均相邻时合并为一次搬运
+    constexpr RegionSlot slots[]{{0, 4}, {4, 4}, {16, 8}, {8, 4}};
+    constexpr BatchPlan<4> plan(slots, 4);
+    static_assert(plan.bytes == 20);
+    static_assert(plan.count == 3);
+    static_assert(plan.moves[0].slot == 0 && plan.moves[0].size == 8);
+    static_assert(plan.moves[1].slot == 8 && plan.moves[1].packed == 16);
+    static_assert(plan.moves[2].slot == 16 && plan.moves[2].packed == 8);
+}
+
+TEST(DataTable, SerializedView)
+{
+    constexpr size_t count = 3;
+    alignas(DataTableView<Es>::alignment) char buf[Table::SerializedBytes() * count];
+    static_assert(DataTableView<Es>::bytes == Table::SerializedBytes());
+    EXPECT_FALSE(Table{}.Serialize(buf, Table::SerializedBytes() - 1));
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        Table table{};
+        table.Set<ID>(i);
+        table.Set<SAMPLES>({1, 2, 3, static_cast<int16_t>(i)});
+        if (i == 1)
+        {
+            table.Set<PRICE>(0.5);
+        }
+        EXPECT_TRUE(table.Serialize(buf + i * Table::SerializedBytes(), Table::SerializedBytes()));
+    }
+
+    auto view = DataTableView<Es>::Attach(buf, sizeof(buf), 1);
+    ASSERT_TRUE(view);
+    EXPECT_EQ(view->Get<ID>(), 1u);
+    EXPECT_TRUE(view->Has<PRICE>());
+    EXPECT_EQ(view->Get<PRICE>(), 0.5);
+    EXPECT_EQ(view->Get<SAMPLES>()[3], 1);
+    EXPECT_FALSE(view->Has<FLAG>());
+    uint32_t id = 0;
+    EXPECT_TRUE(view->GetData(ID, &id, sizeof(id)));
+    EXPECT_EQ(id, 1u);
+    EXPECT_FALSE(view->GetData(FLAG, &id));
+
+    auto last = DataTableView<Es>::Attach(buf, sizeof(buf), 2);
+    ASSERT_TRUE(last);
+    EXPECT_FALSE(last->Has<PRICE>());
+    EXPECT_EQ(last->Get<SAMPLES>()[3], 2);
+    EXPECT_FALSE(DataTableView<Es>::Attach(buf, sizeof(buf), count));
+    EXPECT_FALSE(DataTableView<Es>::Attach(buf + 1, sizeof(buf) - 1));
+
+    // 布局不同的Entry描述拒绝读取
+    using Other = TypeList<Entry<ID, uint64_t>, Entry<PRICE, double>, Entry<FLAG, char>, Entry<VOLUME, int32_t>,
+                           Entry<SAMPLES, int16_t[4]>>;
+    EXPECT_FALSE(DataTableView<Other>::Attach(buf, sizeof(buf)));
+}
+
+namespace {
+template <typename Report>
+constexpr const EntryLayout& LayoutOf(const Report& report, uint64_t key)
+{
+    for (const EntryLayout& entry : report.entries)
+    {
+        if (entry.key == key)
+        {
+            return entry;
+        }
+    }
+    return report.entries[0];
+}
+} // namespace
+
+TEST(DataTable, CacheLayout)
+{
+    // 默认布局:区域按自身对齐紧密排列,无冷热之分
+    constexpr auto& packed = Table::layout;
+    static_assert(packed.totalBytes == 32 && packed.payloadBytes == 25 && packed.paddingBytes == 7);
+    static_assert(packed.hotBytes == 0 && packed.alignment == 8);
+    static_assert(LayoutOf(packed, ID).region == LayoutOf(packed, VOLUME).region);
+    static_assert(LayoutOf(packed, SAMPLES).bytes == 8 && LayoutOf(packed, SAMPLES).offset % alignof(int16_t) == 0);
+
+    // 热记录排在最前并共享首个缓存行,冷记录从下一缓存行开始
+    using HotTable = DataTable<Es, JumpTableDispatch, CacheLayout<0, FLAG, PRICE>>;
+    constexpr auto& hot = HotTable::layout;
+    static_assert(LayoutOf(hot, PRICE).hot && LayoutOf(hot, FLAG).hot && !LayoutOf(hot, ID).hot);
+    static_assert(LayoutOf(hot, PRICE).offset == 0 && LayoutOf(hot, FLAG).offset == 8);
+    static_assert(hot.hotBytes == 9 && hot.HotLines() == 1);
+    static_assert(LayoutOf(hot, ID).offset == cacheLineSize && LayoutOf(hot, SAMPLES).offset >= cacheLineSize);
+    static_assert(hot.regions[2].offset == cacheLineSize && hot.regions[1].padding == cacheLineSize - 9);
+    static_assert(hot.alignment == cacheLineSize && alignof(HotTable) == cacheLineSize);
+    static_assert(hot.payloadBytes == packed.payloadBytes);
+
+    // 每个区域独占缓存行
+    using Aligned = DataTable<Es, JumpTableDispatch, CacheLayout<cacheLineSize>>;
+    constexpr auto& aligned = Aligned::layout;
+    static_assert(aligned.totalBytes == 4 * cacheLineSize);
+    static_assert(aligned.regions[0].offset == 0 && aligned.regions[3].offset == 3 * cacheLineSize);
+    static_assert(aligned.LinesOf(0) == 1);
+
+    HotTable table{};
+    table.Set<PRICE>(2.5);
+    table.Set<SAMPLES>({1, 2, 3, 4});
+    uint32_t id = 7;
+    EXPECT_TRUE(table.SetData(ID, &id, sizeof(id)));
+    EXPECT_EQ(table.Get<PRICE>(), 2.5);
+    EXPECT_EQ(table.Get<SAMPLES>()[3], 4);
+    id = 0;
+    EXPECT_TRUE(table.GetData(ID, &id, sizeof(id)));
+    EXPECT_EQ(id, 7u);
+    EXPECT_EQ(*reinterpret_cast<const double*>(reinterpret_cast<const char*>(&table) + LayoutOf(hot, PRICE).offset),
+              2.5);
+
+    // 序列化数据只能由布局一致的视图读取
+    alignas(DataTableView<Es, CacheLayout<0, FLAG, PRICE>>::alignment) char buf[HotTable::SerializedBytes()];
+    ASSERT_TRUE(table.Serialize(buf, sizeof(buf)));
+    auto view = DataTableView<Es, CacheLayout<0, FLAG, PRICE>>::Attach(buf, sizeof(buf));
+    ASSERT_TRUE(view);
+    EXPECT_EQ(view->Get<PRICE>(), 2.5);
+    EXPECT_FALSE(DataTableView<Es>::Attach(buf, sizeof(buf)));
+    EXPECT_FALSE((DataTableView<Es, CacheLayout<0, PRICE>>::Attach(buf, sizeof(buf))));
+}
+
+TEST(DataTable, CompactLayout)
+{
+    // 默认布局:区域间有填充,每个实例另存一份键->区域索引
+    constexpr TableFootprint packed = Table::Footprint();
+    static_assert(packed.payloadBytes == 25 && packed.regionBytes == 32);
+    static_assert(packed.indexBytes == 5 * sizeof(size_t) + sizeof(std::bitset<5>));
+
+    // 紧凑布局:按对齐从大到小排列,只在末尾补齐;实例只保留掩码
+    using Compact = DataTable<Es, JumpTableDispatch, CompactLayout>;
+    constexpr auto& layout = Compact::layout;
+    static_assert(LayoutOf(layout, PRICE).offset == 0 && LayoutOf(layout, ID).offset == 8);
+    static_assert(LayoutOf(layout, SAMPLES).offset == 16 && LayoutOf(layout, FLAG).offset == 24);
+    static_assert(layout.regions[0].padding == 0 && layout.regions[1].padding == 0 &&
+                  layout.regions[2].padding == 0);
+    static_assert(layout.paddingBytes == 7 && layout.paddingBytes < layout.alignment);
+
+    constexpr TableFootprint compact = Compact::Footprint();
+    static_assert(compact.bytes == sizeof(Compact) && compact.indexBytes == sizeof(std::bitset<5>));
+    static_assert(compact.bytes == compact.regionBytes + compact.indexBytes + compact.dirtyBytes);
+    static_assert(compact.bytes < packed.bytes);
+
+    // 两种派发策略读写同一紧凑存储
+    auto check = []<typename T>(T table) {
+        double price = 4.5;
+        int16_t samples[4]{1, 2, 3, 4};
+        EXPECT_TRUE(table.SetData(PRICE, &price, sizeof(price)));
+        EXPECT_TRUE(table.SetData(SAMPLES, samples, sizeof(samples)));
+        table.template Set<FLAG>('z');
+        EXPECT_EQ(table.template Get<PRICE>(), 4.5);
+        EXPECT_EQ(table.template Get<SAMPLES>()[3], 4);
+        char flag = 0;
+        EXPECT_TRUE(table.GetData(FLAG, &flag, sizeof(flag)));
+        EXPECT_EQ(flag, 'z');
+        EXPECT_FALSE(table.GetData(ID, &price));
+    };
+    check(Compact{});
+    check(DataTable<Es, FoldDispatch, CompactLayout>{});
+}
+
+TEST(DataTable, ArrayElementAccess)
+{
+    Table table{};
+    int16_t sample = 0;
+    EXPECT_FALSE(table.Get(SAMPLES, 1, sample)); // 未设置
+
+    EXPECT_TRUE(table.Set(SAMPLES, 1, int16_t{9}));
+    EXPECT_TRUE(table.Has<SAMPLES>());
+    EXPECT_TRUE(table.IsDirty<SAMPLES>());
+    EXPECT_TRUE(table.Get(SAMPLES, 1, sample));
+    EXPECT_EQ(sample, 9);
+    int32_t wide = 0;
+    EXPECT_FALSE(table.Get(SAMPLES, 1, wide));             // 元素大小不符
+    EXPECT_FALSE(table.Get(SAMPLES, 4, sample));           // 越界
+    EXPECT_FALSE(table.Set(SAMPLES + 1, 0, int16_t{1}));   // 键不存在
+
+    const int16_t tail[]{7, 8};
+    EXPECT_TRUE(table.SetRange(SAMPLES, 2, 2, tail));
+    EXPECT_FALSE(table.SetRange(SAMPLES, 3, 2, tail));
+    int16_t out[3]{};
+    EXPECT_TRUE(table.GetRange(SAMPLES, 1, 3, out));
+    EXPECT_EQ(out[0], 9);
+    EXPECT_EQ(out[1], 7);
+    EXPECT_EQ(out[2], 8);
+    EXPECT_FALSE(table.GetRange(SAMPLES, 2, 3, out));
+
+    // 标量记录按单元素数组访问
+    EXPECT_TRUE(table.Set(PRICE, 0, 1.5));
+    double price = 0;
+    EXPECT_TRUE(table.Get(PRICE, 0, price));
+    EXPECT_EQ(price, 1.5);
+    EXPECT_FALSE(table.Get(PRICE, 1, price));
+
+    // 编译期键的span直接指向存储
+    auto view = table.Ref<SAMPLES>().subspan<2, 2>();
+    static_assert(std::is_same_v<decltype(view), std::span<int16_t, 2>>);
+    view[1] = 11;
+    EXPECT_TRUE(table.Get(SAMPLES, 3, sample));
+    EXPECT_EQ(sample, 11);
+
+    alignas(DataTableView<Es>::alignment) char buf[Table::SerializedBytes()];
+    ASSERT_TRUE(table.Serialize(buf, sizeof(buf)));
+    auto serialized = DataTableView<Es>::Attach(buf, sizeof(buf));
+    ASSERT_TRUE(serialized);
+    EXPECT_TRUE(serialized->Get(SAMPLES, 2, sample));
+    EXPECT_EQ(sample, 7);
+    int16_t head[2]{};
+    EXPECT_TRUE(serialized->GetRange(SAMPLES, 0, 2, head));
+    EXPECT_EQ(head[1], 9);
+    EXPECT_FALSE(serialized->Get(ID, 0, wide)); // 未设置
+}
+
+TEST(DataTable, PartialWriteOnFreshEntry)
+{
+    // 默认初始化不清零存储,先填满非零字节再构造
+    alignas(Table) unsigned char raw[sizeof(Table)];
+    std::memset(raw, 0x5A, sizeof(raw));
+    Table* table = new (raw) Table;
+
+    const int16_t tail[]{7, 8};
+    EXPECT_TRUE(table->SetRange(SAMPLES, 2, 2, tail));
+    int16_t samples[4]{-1, -1, -1, -1};
+    EXPECT_TRUE(table->GetData(SAMPLES, samples, sizeof(samples)));
+    EXPECT_EQ(samples[0], 0);
+    EXPECT_EQ(samples[1], 0);
+    EXPECT_EQ(samples[2], 7);
+    EXPECT_EQ(samples[3], 8);
+
+    EXPECT_TRUE(table->Set(SAMPLES, 0, int16_t{5})); // 已设置的记录不再清零
+    EXPECT_EQ(table->Get<SAMPLES>()[0], 5);
+    EXPECT_EQ(table->Get<SAMPLES>()[2], 7);
+    table->~Table();
+}
+
+TEST(DataTable, DeltaReplication)
+{
+    Table primary{};
+    Table standby{};
+    EXPECT_EQ(primary.DirtyCount(), 0u);
+    primary.Set<ID>(1);
+    primary.Set<SAMPLES>({4, 3, 2, 1});
+    double price = 9.5;
+    primary.SetData(PRICE, &price, sizeof(price));
+    EXPECT_EQ(primary.DirtyCount(), 3u);
+    EXPECT_TRUE(primary.IsDirty<PRICE>());
+    EXPECT_FALSE(primary.IsDirty<FLAG>());
+
+    size_t bytes = primary.DeltaBytes();
+    EXPECT_EQ(bytes, sizeof(DeltaHeader) + 3 * sizeof(DeltaRecord) + sizeof(uint32_t) + sizeof(double) +
+                         sizeof(int16_t[4]));
+    std::vector<char> delta(bytes);
+    EXPECT_EQ(primary.ExportDelta(delta.data(), bytes - 1), 0u);
+    EXPECT_EQ(primary.DirtyCount(), 3u);
+    EXPECT_EQ(primary.ExportDelta(delta.data(), delta.size()), bytes);
+    EXPECT_EQ(primary.DirtyCount(), 0u);
+
+    EXPECT_TRUE(standby.ApplyDelta(delta.data(), delta.size()));
+    EXPECT_EQ(standby.DirtyCount(), 0u); // 收到的增量不会再被转发
+    EXPECT_EQ(standby.Get<ID>(), 1u);
+    EXPECT_EQ(standby.Get<PRICE>(), 9.5);
+    EXPECT_EQ(standby.Get<SAMPLES>()[0], 4);
+    EXPECT_FALSE(standby.Has<FLAG>());
+
+    // 只导出变化的记录
+    primary.Set<FLAG>('q');
+    delta.resize(primary.DeltaBytes());
+    EXPECT_EQ(primary.ExportDelta(delta.data(), delta.size()), sizeof(DeltaHeader) + sizeof(DeltaRecord) + 1);
+    EXPECT_TRUE(standby.ApplyDelta(delta.data(), delta.size()));
+    EXPECT_EQ(standby.Get<FLAG>(), 'q');
+
+    // 截断或篡改的增量不做任何修改
+    primary.Set<ID>(2);
+    primary.Set<VOLUME>(3);
+    delta.resize(primary.DeltaBytes());
+    primary.ExportDelta(delta.data(), delta.size());
+    EXPECT_FALSE(standby.ApplyDelta(delta.data(), delta.size() - 1));
+    delta[sizeof(DeltaHeader)] = SAMPLES + 1;
+    EXPECT_FALSE(standby.ApplyDelta(delta.data(), delta.size()));
+    EXPECT_EQ(standby.Get<ID>(), 1u);
+    EXPECT_FALSE(standby.Has<VOLUME>());
+}
+
+TEST(DataTable, PerfectHash)
+{
+    constexpr PerfectHash<6> hash(std::array<uint64_t, 6>{1001, 40017, 65535, 7, 12345678901, 3});
+    static_assert(hash.Verify());
+    static_assert(!hash.IsDense());
+    static_assert(hash.Find(40017) < 6 && hash.KeyAt(hash.Find(40017)) == 40017);
+    static_assert(hash.Find(40018) == 6);
+    static_assert(!PerfectHash<3>(std::array<uint64_t, 3>{5, 9, 5}).Verify()); // 重复的键
+
+    constexpr PerfectHash<3> dense(std::array<uint64_t, 3>{2, 0, 1});
+    static_assert(dense.IsDense() && dense.Find(2) == 2 && dense.Find(3) == 3);
+}
+
+TEST(DataTable, SparseKeys)
+{
+    enum class Tag : uint32_t
+    {
+        BID = 1001,
+        ASK = 40017,
+        LAST = 65535,
+    };
+    using Sparse = DataTable<TypeList<Entry<Tag::BID, double>, Entry<Tag::ASK, double>, Entry<Tag::LAST, int16_t[2]>,
+                                      Entry<7, char>>>;
+    Sparse table{};
+    table.Set<Tag::ASK>(10.5);
+    table.Set<Tag::LAST>({1, 2});
+    EXPECT_TRUE(table.Has<Tag::ASK>());
+    EXPECT_FALSE(table.Has<Tag::BID>());
+    EXPECT_EQ(table.Get<Tag::ASK>(), 10.5);
+
+    double bid = 9.5;
+    EXPECT_TRUE(table.SetData(1001, &bid, sizeof(bid)));
+    EXPECT_FALSE(table.SetData(1002, &bid, sizeof(bid)));
+    EXPECT_FALSE(table.SetData(0, &bid, sizeof(bid)));
+    double out = 0;
+    EXPECT_TRUE(table.GetData(1001, &out, sizeof(out)));
+    EXPECT_EQ(out, 9.5);
+    EXPECT_EQ(table.Get<Tag::BID>(), 9.5);
+    int16_t last[2]{};
+    EXPECT_TRUE(table.GetData(static_cast<size_t>(Tag::LAST), last, sizeof(last)));
+    EXPECT_EQ(last[1], 2);
+
+    const size_t keys[]{65535, 40017};
+    auto batch = Sparse::MakeBatch(keys);
+    ASSERT_TRUE(batch);
+    EXPECT_FALSE(Sparse::MakeBatch(std::array<size_t, 1>{3}));
+
+    Sparse standby{};
+    std::vector<char> delta(table.DeltaBytes());
+    table.ExportDelta(delta.data(), delta.size());
+    EXPECT_TRUE(standby.ApplyDelta(delta.data(), delta.size()));
+    EXPECT_EQ(standby.Get<Tag::BID>(), 9.5);
+    EXPECT_FALSE(standby.Has<7>());
+}
+
+TEST(DataTable, NamedKeys)
+{
+    using Named = TypeList<Entry<"latency_ms"_fs, uint32_t>,
+                           Entry<"region"_fs, char[8]>,
+                           Entry<"ratio"_fs, double>,
+                           Entry<ID, int32_t>>;
+    using Layout = DataTableLayout<Named>;
+    static_assert(Layout::ordinalOf<"ratio"_fs> < Named::size);
+    static_assert(Layout::OrdinalOf(std::string_view("region")) == Layout::ordinalOf<"region"_fs>);
+    static_assert(Layout::OrdinalOf(std::string_view("regio")) == Named::size);
+    static_assert(Layout::report.entries[Layout::ordinalOf<"ratio"_fs>].name == "ratio");
+
+    DataTable<Named> table;
+    table.Set<"latency_ms"_fs>(42);
+    EXPECT_EQ(table.Get<"latency_ms"_fs>(), 42u);
+
+    double ratio = 0.25;
+    EXPECT_TRUE(table.SetData("ratio", &ratio, sizeof(ratio)));
+    double out = 0;
+    EXPECT_TRUE(table.GetData("ratio", &out, sizeof(out)));
+    EXPECT_EQ(out, 0.25);
+    EXPECT_EQ(table.Get<"ratio"_fs>(), 0.25);
+
+    uint32_t latency = 0;
+    EXPECT_TRUE(table.GetData(std::string_view("latency_ms"), &latency));
+    EXPECT_EQ(latency, 42u);
+    EXPECT_FALSE(table.GetData("latency_m", &latency));
+    EXPECT_FALSE(table.GetData("latency_ms_", &latency));
+    EXPECT_FALSE(table.GetData("region", &out));
+
+    // 整型接口不会命中名字键的哈希,名字接口也不会命中整型键
+    EXPECT_FALSE(table.GetData(KeyHash("ratio"_fs), &out));
+    int32_t id = 7;
+    EXPECT_TRUE(table.SetData(ID, &id));
+    EXPECT_FALSE(table.GetData("", &id));
+
+    std::vector<uint64_t> buffer(DataTableView<Named>::bytes / sizeof(uint64_t) + 1);
+    ASSERT_TRUE(table.Serialize(buffer.data(), DataTableView<Named>::bytes));
+    auto view = DataTableView<Named>::Attach(buffer.data(), DataTableView<Named>::bytes);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_TRUE(view->GetData("ratio", &out));
+    EXPECT_EQ(out, 0.25);
+    EXPECT_EQ(view->Get<ID>(), 7);
+    EXPECT_FALSE(view->Has<"region"_fs>());
+}
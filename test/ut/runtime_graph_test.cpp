@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "runtime_graph.h"
+
+namespace {
+using A = Node<'A'>;
+using B = Node<'B'>;
+using C = Node<'C'>;
+using D = Node<'D'>;
+using E = Node<'E'>;
+
+using Static = Graph<LINK(NODE(A)->NODE(B)->NODE(C)->NODE(D)),
+                     LINK(NODE(A)->NODE(C)),
+                     LINK(NODE(B)->NODE(A)),
+                     LINK(NODE(A)->NODE(E))>;
+
+std::string ToString(PathRef<char> path)
+{
+    return path.sz == 0 ? std::string() : std::string(path.path, path.sz);
+}
+} // namespace
+
+TEST(RuntimeGraph, SeededFromStaticGraph)
+{
+    static_assert(Static::adjacency.outStart.back() == Static::edgesNum);
+
+    RuntimeGraph<char> graph = RuntimeGraph<char>::FromGraph<Static>();
+    EXPECT_EQ(graph.NodesNum(), Static::nodesNum);
+    EXPECT_EQ(graph.EdgesNum(), Static::edgesNum);
+    for (char from : Static::nodeIds)
+    {
+        EXPECT_EQ(graph.OrdinalOf(from), Static::OrdinalOf(from));
+        for (char to : Static::nodeIds)
+        {
+            EXPECT_EQ(ToString(graph.GetShortestPath(from, to)), ToString(Static::GetShortestPath(from, to)))
+                << from << " -> " << to;
+        }
+    }
+    EXPECT_EQ(graph.GetShortestPath('Z', 'A').sz, 0u);
+}
+
+TEST(RuntimeGraph, ExtendAtRuntime)
+{
+    RuntimeGraph<char> graph = RuntimeGraph<char>::FromGraph<Static>();
+    EXPECT_FALSE(graph.IsReachable('D', 'E'));
+
+    graph.AddEdge('D', 'F');
+    graph.AddEdge('F', 'E');
+    EXPECT_EQ(ToString(graph.GetShortestPath('D', 'E')), "DFE");
+    EXPECT_EQ(ToString(graph.GetShortestPath('C', 'E')), "CDFE");
+    EXPECT_EQ(graph.NodesNum(), Static::nodesNum + 1);
+
+    graph.AddEdge('C', 'E');
+    EXPECT_EQ(ToString(graph.GetShortestPath('C', 'E')), "CE");
+    // 原有路径不受影响
+    EXPECT_EQ(ToString(graph.GetShortestPath('A', 'D')), "ACD");
+}
+
+TEST(RuntimeGraph, MultiSourceBfs)
+{
+    RuntimeGraph<int> graph;
+    for (int i = 0; i < 9; ++i)
+    {
+        graph.AddEdge(i, i + 1);
+    }
+    const std::vector<uint32_t>& single = graph.Bfs(0);
+    EXPECT_EQ(single[graph.OrdinalOf(9)], 9u);
+
+    std::vector<int> sources{0, 6, 42};
+    const std::vector<uint32_t>& dist = graph.Bfs(sources);
+    EXPECT_EQ(dist[graph.OrdinalOf(5)], 5u);
+    EXPECT_EQ(dist[graph.OrdinalOf(6)], 0u);
+    EXPECT_EQ(dist[graph.OrdinalOf(9)], 3u);
+
+    graph.AddNode(100);
+    EXPECT_EQ(graph.Bfs(sources)[graph.OrdinalOf(100)], RuntimeGraph<int>::unreachable);
+}
+
+TEST(RuntimeGraph, ParallelBfsMatchesSerial)
+{
+    constexpr int nodes = 20000;
+    RuntimeGraph<int> graph;
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> pick(0, nodes - 1);
+    for (int i = 0; i < nodes * 4; ++i)
+    {
+        graph.AddEdge(pick(rng), pick(rng));
+    }
+
+    std::vector<int> sources{0, 1, 2};
+    std::vector<uint32_t> expected = graph.Bfs(sources);
+    for (size_t threads : {1, 2, 4})
+    {
+        EXPECT_EQ(graph.ParallelBfs(sources, threads), expected) << threads;
+    }
+}
+
+namespace {
+using Named = Graph<LINK(NODE(Node<"ingress"_fs>)->NODE(Node<"parse"_fs>)->NODE(Node<"egress"_fs>))>;
+} // namespace
+
+TEST(RuntimeGraph, NamedNodes)
+{
+    RuntimeGraph<std::string_view> graph = RuntimeGraph<std::string_view>::FromGraph<Named>();
+    graph.AddEdge("parse", "audit");
+    PathRef<std::string_view> path = graph.GetShortestPath("ingress", "audit");
+    ASSERT_EQ(path.sz, 3u);
+    EXPECT_EQ(path.path[2], "audit");
+    EXPECT_EQ(graph.OrdinalOf("egress"), Named::OrdinalOf("egress"));
+
+    // 运行期拼出的名字在调用方缓冲区释放后仍可查询
+    for (int i = 0; i < 3; ++i)
+    {
+        std::string shard = "shard_" + std::to_string(i);
+        graph.AddEdge("audit", shard);
+    }
+    RuntimeGraph<std::string_view> copy = graph;
+    graph = RuntimeGraph<std::string_view>{};
+    path = copy.GetShortestPath("ingress", std::string("shard_2"));
+    ASSERT_EQ(path.sz, 4u);
+    EXPECT_EQ(path.path[3], "shard_2");
+    EXPECT_EQ(copy.IdOf(copy.OrdinalOf("shard_0")), "shard_0");
+}
@@ -1,9 +1,15 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <optional>
+#include <string>
 #include <tuple>
 #include <type_traits>
 #include <variant>
+#include <vector>
 
+#include "exhaustive_path_finder.h"
 #include "graph.h"
 #include "type_list.h"
 
@@ -55,6 +61,21 @@ TEST(TypeList, Func)
     static_assert(std::is_same_v<Partition_t<LongList, SizeLess4>::Satisfied, TypeList<char, char>>);
     static_assert(std::is_same_v<Partition_t<LongList, SizeLess4>::Rest, TypeList<float, double, int>>);
     static_assert(std::is_same_v<Sort_t<LongList, sizeCmp>, TypeList<char, char, float, int, double>>);
+    static_assert(std::is_same_v<At_t<LongList, 0>, char>);
+    static_assert(std::is_same_v<At_t<LongList, 3>, int>);
+    static_assert(IndexOf_v<LongList, double> == 2);
+    static_assert(IndexOf_v<LongList, char> == 0);
+    static_assert(IndexOf_v<LongList, short> == LongList::size);
+    static_assert(std::is_same_v<Slice_t<LongList, 1, 3>, TypeList<float, double>>);
+    static_assert(std::is_same_v<Concat_t<>, TypeList<>>);
+    static_assert(std::is_same_v<Concat_t<TypeList<int>, TypeList<>, TypeList<char, int>>, TypeList<int, char, int>>);
+    static_assert(std::is_same_v<Filter_t<TypeList<>, SizeLess4>, TypeList<>>);
+    static_assert(std::is_same_v<Unique_t<TypeList<>>, TypeList<>>);
+    static_assert(std::is_same_v<Sort_t<TypeList<>, sizeCmp>, TypeList<>>);
+    static_assert(std::is_same_v<Sort_t<TypeList<int>, sizeCmp>, TypeList<int>>);
+    // 归并排序稳定：等长元素保持原有相对顺序
+    static_assert(std::is_same_v<Sort_t<TypeList<double, int, char, float, short, unsigned>, sizeCmp>,
+                                 TypeList<char, short, int, float, unsigned, double>>);
 
     //	static_assert(g::GetShortestPath('A', 'D').sz == 3);
     //	std::cout << g::PathFinder<A, E>::type::size << std::endl;
@@ -78,4 +99,380 @@ TEST(TypeList, Func)
     // TypeList<Edge<A, B>, Edge<B, C>, Edge<C, D>>>);
     //	//static_assert(std::is_same_v<g::Edges, TypeList<Edge<A, B>, Edge<B,
     // C>, Edge<C, D>, Edge<A, C>, Edge<B, A>, Edge<A, E>>>);
-}
\ No newline at end of file
+}
+TEST(Graph, ShortestPathTable)
+{
+    static_assert(g::nodesNum == 5);
+    static_assert(g::GetShortestPath('A', 'D').sz == 3);
+    static_assert(g::IsReachable('B', 'E'));
+    static_assert(!g::IsReachable('D', 'E'));
+    static_assert(!g::IsReachable('A', 'Z'));
+    static_assert(g::OrdinalOf('Z') == g::nodesNum);
+
+    auto path = g::GetShortestPath('A', 'D');
+    EXPECT_EQ(std::string(path.path, path.sz), "ACD");
+    path = g::GetShortestPath('B', 'E');
+    EXPECT_EQ(std::string(path.path, path.sz), "BAE");
+
+    // 与穷举实现选出同一条路径
+    using Reference = ExhaustivePathFinder<g::Edges>;
+    for (char from : std::string("ABCDE"))
+    {
+        for (char to : std::string("ABCDE"))
+        {
+            PathRef<char> expected = Reference::GetShortestPath(from, to);
+            path = g::GetShortestPath(from, to);
+            EXPECT_EQ(std::string(path.path, path.sz), std::string(expected.path, expected.sz));
+        }
+    }
+}
+
+namespace {
+template <int I>
+using N = Node<char('a' + I)>;
+
+// 多条等长路径并存,检验选路顺序
+using Diamond = Graph<LINK(NODE(N<0>)->NODE(N<1>)->NODE(N<3>)->NODE(N<5>)),
+                      LINK(NODE(N<0>)->NODE(N<2>)->NODE(N<4>)->NODE(N<5>)),
+                      LINK(NODE(N<2>)->NODE(N<3>)->NODE(N<0>)),
+                      LINK(NODE(N<1>)->NODE(N<4>)->NODE(N<2>)),
+                      LINK(NODE(N<5>)->NODE(N<6>)->NODE(N<7>)->NODE(N<1>)),
+                      LINK(NODE(N<7>)->NODE(N<3>))>;
+} // namespace
+
+TEST(Graph, MatchesExhaustiveSearch)
+{
+    using Reference = ExhaustivePathFinder<Diamond::Edges>;
+    for (char from = 'a'; from < 'a' + 8; ++from)
+    {
+        for (char to = 'a'; to < 'a' + 8; ++to)
+        {
+            PathRef<char> expected = Reference::GetShortestPath(from, to);
+            PathRef<char> path = Diamond::GetShortestPath(from, to);
+            EXPECT_EQ(std::string(path.path, path.sz), std::string(expected.path, expected.sz))
+                << from << " -> " << to;
+        }
+    }
+}
+
+namespace {
+// A到D:直连边权为10,经B、C三跳边权为3,经E两跳边权为4
+using Weighted = Graph<LINK(NODE(A)->COST(10)->NODE(D)),
+                       LINK(NODE(A)->NODE(B)->NODE(C)->NODE(D)),
+                       LINK(NODE(A)->COST(2)->NODE(E)->COST(2)->NODE(D))>;
+} // namespace
+
+TEST(Graph, WeightedEdges)
+{
+    static_assert(std::is_same_v<Chain_t<LINK(NODE(A)->COST(5)->NODE(B)->NODE(C))>,
+                                 TypeList<Edge<A, B, 5>, Edge<B, C>>>);
+    static_assert(Weighted::GetShortestPath('A', 'D').sz == 2);
+    static_assert(Weighted::GetCheapestPath('A', 'D').sz == 4);
+    static_assert(Weighted::GetCost('A', 'D') == 3);
+    static_assert(Weighted::GetCost('A', 'E') == 2);
+    static_assert(Weighted::GetCost('B', 'B') == 0);
+    static_assert(!Weighted::GetCost('D', 'A').has_value());
+
+    auto path = Weighted::GetCheapestPath('A', 'D');
+    EXPECT_EQ(std::string(path.path, path.sz), "ABCD");
+    EXPECT_EQ(path.cost, 3u);
+    path = Weighted::GetCheapestPath('E', 'D');
+    EXPECT_EQ(std::string(path.path, path.sz), "ED");
+    EXPECT_EQ(path.cost, 2u);
+
+    // 边权均为1时两种路径一致
+    for (char from : std::string("ABCDE"))
+    {
+        for (char to : std::string("ABCDE"))
+        {
+            PathRef<char> shortest = g::GetShortestPath(from, to);
+            WeightedPathRef<char> cheapest = g::GetCheapestPath(from, to);
+            EXPECT_EQ(std::string(cheapest.path, cheapest.sz), std::string(shortest.path, shortest.sz));
+            EXPECT_EQ(g::GetCost(from, to), shortest.sz > 0 ? std::optional<size_t>(shortest.sz - 1) : std::nullopt);
+        }
+    }
+}
+
+namespace {
+template <typename G>
+void ExpectRoutesMatchPaths(bool weighted)
+{
+    for (typename G::NodeId from : G::nodeIds)
+    {
+        for (typename G::NodeId to : G::nodeIds)
+        {
+            PathRef<typename G::NodeId> path =
+                weighted ? G::GetCheapestPath(from, to) : G::GetShortestPath(from, to);
+            typename G::RouteType route = weighted ? G::GetCheapestRoute(from, to) : G::GetRoute(from, to);
+            std::string nodes;
+            for (auto id : route)
+            {
+                nodes.push_back(id);
+            }
+            EXPECT_EQ(nodes, std::string(path.path, path.sz)) << from << " -> " << to;
+            EXPECT_EQ(route.size(), path.sz);
+            EXPECT_EQ(route.empty(), path.sz == 0);
+        }
+    }
+}
+} // namespace
+
+TEST(Graph, NextHopRoutes)
+{
+    static_assert(std::is_same_v<SmallestUint_t<255>, uint8_t>);
+    static_assert(std::is_same_v<SmallestUint_t<256>, uint16_t>);
+    static_assert(g::GetRoute('A', 'D').size() == 3);
+    static_assert(*g::GetRoute('A', 'D').begin() == 'A');
+    static_assert(g::GetRoute('D', 'E').empty());
+    static_assert(g::GetRoute('Z', 'A').empty());
+
+    ExpectRoutesMatchPaths<g>(false);
+    ExpectRoutesMatchPaths<Diamond>(false);
+    ExpectRoutesMatchPaths<Weighted>(false);
+    ExpectRoutesMatchPaths<Weighted>(true);
+
+    // 两种存储方式静态表的sizeof之和,实测段大小见compile_cost的route_storage.csv
+    static_assert(Diamond::routeBytes<> < Diamond::pathRefBytes<>);
+    RecordProperty("DiamondPathRefBytes", static_cast<int>(Diamond::pathRefBytes<>));
+    RecordProperty("DiamondRouteBytes", static_cast<int>(Diamond::routeBytes<>));
+}
+
+namespace {
+// 带处理器的顶点,把自己的id追加到轨迹上
+template <char Id>
+struct Stage
+{
+    constexpr static char id = Id;
+    static void Handle(std::string& trace) { trace.push_back(Id); }
+};
+
+using Pipeline = Graph<LINK(NODE(Stage<'A'>)->NODE(Stage<'B'>)->NODE(Stage<'C'>)->NODE(Stage<'D'>)),
+                       LINK(NODE(Stage<'A'>)->NODE(Stage<'C'>)),
+                       LINK(NODE(Stage<'B'>)->NODE(Stage<'A'>)),
+                       LINK(NODE(Stage<'A'>)->NODE(Stage<'E'>))>;
+} // namespace
+
+TEST(Graph, RunFusedPath)
+{
+    std::string trace;
+    Pipeline::Run<Stage<'A'>, Stage<'D'>>(trace);
+    EXPECT_EQ(trace, "ACD");
+    trace.clear();
+    Pipeline::Run<Stage<'B'>, Stage<'E'>>(trace);
+    EXPECT_EQ(trace, "BAE");
+
+    // 运行期起止点经跳转表执行,与路径查询一致
+    for (char from : Pipeline::nodeIds)
+    {
+        for (char to : Pipeline::nodeIds)
+        {
+            trace.clear();
+            PathRef<char> path = Pipeline::GetShortestPath(from, to);
+            EXPECT_EQ(Pipeline::Run(from, to, trace), path.sz > 0);
+            EXPECT_EQ(trace, std::string(path.path, path.sz)) << from << " -> " << to;
+        }
+    }
+    trace.clear();
+    EXPECT_FALSE(Pipeline::Run('Z', 'A', trace));
+    EXPECT_TRUE(trace.empty());
+}
+
+namespace {
+enum class Port : uint16_t
+{
+    In = 7,
+    Parse = 900,
+    Emit = 60000,
+};
+
+// id跨度大,经完美哈希寻址
+using Sparse = Graph<LINK(NODE(Node<1000>)->NODE(Node<-5>)->NODE(Node<70000>)),
+                     LINK(NODE(Node<1000>)->NODE(Node<70000>))>;
+// id超出单字节但连续,按偏移直接寻址
+using Wide = Graph<LINK(NODE(Node<300>)->NODE(Node<301>)->NODE(Node<302>)), LINK(NODE(Node<302>)->NODE(Node<300>))>;
+using ByEnum = Graph<LINK(NODE(Node<Port::In>)->NODE(Node<Port::Parse>)->NODE(Node<Port::Emit>))>;
+using ByName = Graph<LINK(NODE(Node<"ingress"_fs>)->NODE(Node<"parse"_fs>)->NODE(Node<"egress"_fs>)),
+                     LINK(NODE(Node<"parse"_fs>)->NODE(Node<"ingress"_fs>))>;
+// id取遍整个64位值域
+using FullRange = Graph<LINK(NODE(Node<uint64_t{0}>)->NODE(Node<UINT64_MAX>))>;
+} // namespace
+
+TEST(Graph, NodeIdKinds)
+{
+    static_assert(std::is_same_v<Sparse::NodeId, int>);
+    static_assert(Sparse::nodesNum == 3);
+    static_assert(Sparse::OrdinalOf(1000) == 0 && Sparse::OrdinalOf(-5) == 1 && Sparse::OrdinalOf(70000) == 2);
+    static_assert(Sparse::OrdinalOf(5) == Sparse::nodesNum);
+    static_assert(Sparse::GetShortestPath(1000, 70000).sz == 2);
+    static_assert(Wide::GetShortestPath(301, 300).sz == 3);
+    static_assert(Wide::OrdinalOf(303) == Wide::nodesNum);
+    static_assert(ByEnum::GetShortestPath(Port::In, Port::Emit).sz == 3);
+    static_assert(std::is_same_v<ByName::NodeId, std::string_view>);
+    static_assert(ByName::GetShortestPath("ingress", "egress").sz == 3);
+    static_assert(ByName::OrdinalOf("nope") == ByName::nodesNum);
+    static_assert(FullRange::GetShortestPath(uint64_t{0}, UINT64_MAX).sz == 2);
+    static_assert(FullRange::OrdinalOf(1) == FullRange::nodesNum);
+
+    // 超出id取值范围的整数不会截断成另一个顶点:'A' + 256截断为char即为'A'
+    static_assert(g::IsReachable('A', 'E'));
+    static_assert(!g::IsReachable('A' + 256, 'E'));
+    static_assert(!g::IsReachable('A', 'E' - 256));
+    static_assert(g::GetShortestPath('A' + 256, 'D').sz == 0);
+    static_assert(Wide::GetShortestPath(301, 300u).sz == 3);
+    static_assert(Wide::GetShortestPath(301, int64_t{300} - (int64_t{1} << 32)).sz == 0);
+    static_assert(!std::is_constructible_v<ByName::NodeKey, int>);
+
+    // 顶点id与序号两种形式可混用
+    PathRef<int> byId = Sparse::GetShortestPath(1000, -5);
+    PathRef<int> byOrdinal = Sparse::GetShortestPath(NodeOrdinal{0}, NodeOrdinal{1});
+    PathRef<int> mixed = Sparse::GetShortestPath(1000, NodeOrdinal{1});
+    EXPECT_EQ(std::vector<int>(byId.path, byId.path + byId.sz), (std::vector<int>{1000, -5}));
+    EXPECT_EQ(byOrdinal.path, byId.path);
+    EXPECT_EQ(mixed.path, byId.path);
+    EXPECT_EQ(Sparse::GetShortestPath(NodeOrdinal{3}, NodeOrdinal{0}).sz, 0u);
+
+    std::string from = "parse";
+    PathRef<std::string_view> named = ByName::GetShortestPath(from, "egress");
+    ASSERT_EQ(named.sz, 2u);
+    EXPECT_EQ(named.path[0], "parse");
+    EXPECT_EQ(named.path[1], "egress");
+    EXPECT_FALSE(ByName::IsReachable(NodeOrdinal{ByName::OrdinalOf("egress")}, "egress"));
+
+    std::vector<Port> ports;
+    for (Port port : ByEnum::GetRoute(Port::In, Port::Emit))
+    {
+        ports.push_back(port);
+    }
+    EXPECT_EQ(ports, (std::vector<Port>{Port::In, Port::Parse, Port::Emit}));
+}
+
+namespace {
+template <typename G>
+void ExpectClosureMatchesPaths()
+{
+    for (size_t from = 0; from < G::nodesNum; ++from)
+    {
+        size_t count = 0;
+        for (size_t to = 0; to < G::nodesNum; ++to)
+        {
+            bool reachable = G::GetShortestPath(NodeOrdinal{from}, NodeOrdinal{to}).sz > 0;
+            EXPECT_EQ(G::IsReachable(NodeOrdinal{from}, NodeOrdinal{to}), reachable) << from << " -> " << to;
+            EXPECT_EQ(G::ReachableFrom(NodeOrdinal{from}).Test(to), reachable);
+            count += reachable;
+        }
+        EXPECT_EQ(G::ReachableFrom(NodeOrdinal{from}).Count(), count);
+    }
+}
+} // namespace
+
+TEST(Graph, ReachabilityClosure)
+{
+    ExpectClosureMatchesPaths<g>();
+    ExpectClosureMatchesPaths<Diamond>();
+    ExpectClosureMatchesPaths<Sparse>();
+    ExpectClosureMatchesPaths<Wide>();
+
+    // A可达B、C、D、E及自身(经B回到A)
+    static_assert(g::ReachableFrom('A').Count() == 5);
+    static_assert(g::ReachableFrom('D').None());
+    static_assert(g::ReachableFrom('Z').None());
+    static_assert(!g::IsReachable('D', 'D'));
+
+    constexpr g::ReachSet exits = g::MakeNodeSet({'D', 'E', 'Z'});
+    static_assert(exits.Count() == 2);
+    static_assert(g::ReachableFrom('C').CountCommon(exits) == 1);
+    static_assert(g::ReachableFrom('B').Contains(exits));
+    static_assert(!g::ReachableFrom('C').Intersects(g::MakeNodeSet({'A', 'B'})));
+    static_assert((g::ReachableFrom('C') | exits) == g::MakeNodeSet({'C', 'D', 'E'}));
+
+    std::string nodes;
+    g::ReachableFrom('B').ForEach([&nodes](size_t ordinal) { nodes.push_back(g::nodeIds[ordinal]); });
+    std::sort(nodes.begin(), nodes.end());
+    EXPECT_EQ(nodes, "ABCDE");
+}
+
+namespace {
+template <typename... Es>
+std::vector<std::pair<char, char>> EdgeList(TypeList<Es...>)
+{
+    return {{Es::From::id, Es::To::id}...};
+}
+
+// 对照:按边声明顺序递归枚举全部简单路径,再按长度稳定排序
+void CollectSimplePaths(const std::vector<std::pair<char, char>>& edges, char to, std::string& stack,
+                        std::vector<std::string>& out)
+{
+    if (stack.back() == to)
+    {
+        out.push_back(stack);
+        return;
+    }
+    for (auto [from, next] : edges)
+    {
+        if (from == stack.back() && stack.find(next) == std::string::npos)
+        {
+            stack.push_back(next);
+            CollectSimplePaths(edges, to, stack, out);
+            stack.pop_back();
+        }
+    }
+}
+
+template <typename G>
+constexpr size_t CountPaths(char from, char to, size_t maxPaths = SIZE_MAX, size_t maxNodes = SIZE_MAX)
+{
+    size_t count = 0;
+    for (PathRef<char> path : G::EnumeratePaths(from, to, maxPaths, maxNodes))
+    {
+        count += path.sz > 0;
+    }
+    return count;
+}
+} // namespace
+
+TEST(Graph, EnumeratePaths)
+{
+    std::vector<std::pair<char, char>> edges = EdgeList(Diamond::Edges{});
+    for (char from : Diamond::nodeIds)
+    {
+        for (char to : Diamond::nodeIds)
+        {
+            std::vector<std::string> expected;
+            if (Diamond::GetShortestPath(from, to).sz > 0)
+            {
+                std::string stack(1, from);
+                CollectSimplePaths(edges, to, stack, expected);
+                std::stable_sort(expected.begin(), expected.end(),
+                                 [](const std::string& a, const std::string& b) { return a.size() < b.size(); });
+            }
+            std::vector<std::string> paths;
+            for (PathRef<char> path : Diamond::EnumeratePaths(from, to))
+            {
+                paths.emplace_back(path.path, path.sz);
+            }
+            EXPECT_EQ(paths, expected) << from << " -> " << to;
+            if (!paths.empty())
+            {
+                PathRef<char> shortest = Diamond::GetShortestPath(from, to);
+                EXPECT_EQ(paths.front(), std::string(shortest.path, shortest.sz));
+            }
+        }
+    }
+
+    // A到D:ACD、ABCD
+    static_assert(CountPaths<g>('A', 'D') == 2);
+    static_assert(CountPaths<g>('A', 'D', 1) == 1);
+    static_assert(CountPaths<g>('A', 'D', SIZE_MAX, 3) == 1);
+    static_assert(CountPaths<g>('B', 'B') == 1);
+    static_assert(CountPaths<g>('D', 'A') == 0);
+    static_assert(CountPaths<g>('A', 'Z') == 0);
+
+    // 提前结束:只取第一条
+    std::string first;
+    for (PathRef<char> path : g::EnumeratePaths('B', 'D'))
+    {
+        first.assign(path.path, path.sz);
+        break;
+    }
+    EXPECT_EQ(first, "BCD");
+}
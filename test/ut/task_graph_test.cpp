@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <atomic>
+#include <string>
+
+#include "task_graph.h"
+
+namespace {
+using A = Node<'A'>;
+using B = Node<'B'>;
+using C = Node<'C'>;
+using D = Node<'D'>;
+using E = Node<'E'>;
+
+// A扇出到B、C、D,再汇聚到E
+using Pipeline = Graph<LINK(NODE(A)->NODE(B)->NODE(E)),
+                       LINK(NODE(A)->NODE(C)->NODE(E)),
+                       LINK(NODE(A)->NODE(D)->NODE(E))>;
+
+// 记录每个任务完成的先后,检查其前驱均已完成
+struct Recorder
+{
+    std::array<std::atomic<int>, 5> finishedAt{};
+    std::atomic<int> clock{0};
+    std::atomic<int> violations{0};
+
+    void Finish(char id, std::initializer_list<char> before)
+    {
+        for (char pred : before)
+        {
+            if (finishedAt[pred - 'A'].load(std::memory_order_relaxed) == 0)
+            {
+                violations.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        finishedAt[id - 'A'].store(clock.fetch_add(1) + 1, std::memory_order_relaxed);
+    }
+};
+
+auto MakePipeline(Recorder& rec)
+{
+    return MakeTaskGraph<Pipeline>(Bind<E>([&rec] { rec.Finish('E', {'B', 'C', 'D'}); }),
+                                   Bind<A>([&rec] { rec.Finish('A', {}); }),
+                                   Bind<B>([&rec] { rec.Finish('B', {'A'}); }),
+                                   Bind<C>([&rec] { rec.Finish('C', {'A'}); }),
+                                   Bind<D>([&rec] { rec.Finish('D', {'A'}); }));
+}
+} // namespace
+
+TEST(TaskGraph, CompileTimeTopology)
+{
+    using Tasks = decltype(MakePipeline(std::declval<Recorder&>()));
+    static_assert(Tasks::topology.size == 5);
+    static_assert(Pipeline::nodeIds[Tasks::topology.ordinals.front()] == 'A');
+    static_assert(Pipeline::nodeIds[Tasks::topology.ordinals.back()] == 'E');
+    static_assert(Tasks::indegree[Pipeline::OrdinalOf('E')] == 3);
+
+    Recorder rec;
+    auto tasks = MakePipeline(rec);
+    tasks.RunSequential();
+    EXPECT_EQ(rec.violations.load(), 0);
+    EXPECT_EQ(rec.finishedAt['E' - 'A'].load(), 5);
+}
+
+TEST(TaskGraph, RunOnPool)
+{
+    TaskPool pool(4);
+    for (int round = 0; round < 200; ++round)
+    {
+        Recorder rec;
+        auto tasks = MakePipeline(rec);
+        tasks.Run(pool);
+        ASSERT_EQ(rec.violations.load(), 0) << round;
+        ASSERT_EQ(rec.clock.load(), 5) << round;
+        ASSERT_EQ(rec.finishedAt['E' - 'A'].load(), 5) << round;
+    }
+}
+
+TEST(TaskGraph, TaskPoolRunsRawDag)
+{
+    // 0 -> 1 -> 3, 0 -> 2 -> 3,任务写入普通数组,由依赖计数保证可见性
+    constexpr std::array<uint32_t, 4> indegree{0, 1, 1, 2};
+    constexpr std::array<size_t, 5> outStart{0, 2, 3, 4, 4};
+    constexpr std::array<size_t, 4> outTo{1, 2, 3, 3};
+    std::array<int, 4> values{};
+    auto invoke = [](void* context, size_t ordinal) {
+        auto& v = *static_cast<std::array<int, 4>*>(context);
+        v[ordinal] = ordinal == 0 ? 1 : ordinal == 3 ? v[1] + v[2] : v[0] * 10 + static_cast<int>(ordinal);
+    };
+    for (size_t threads : {1, 2, 8})
+    {
+        TaskPool pool(threads);
+        values.fill(0);
+        pool.Run(4, indegree.data(), outStart.data(), outTo.data(), invoke, &values);
+        EXPECT_EQ(values[3], 23) << threads;
+    }
+}